@@ -0,0 +1,427 @@
+/**============================================================================
+Name        : AsyncChannel.h
+Created on  : 19.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Coroutine channel backed by DVector, with the basic executors
+============================================================================**/
+
+#ifndef CPPPROJECTS_ASYNCCHANNEL_H
+#define CPPPROJECTS_ASYNCCHANNEL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <thread>
+#include <vector>
+#include "DVector.h"
+
+namespace DVector
+{
+    /** Resumes the coroutines woken up by the channel. post() never resumes inline: **/
+    struct Executor
+    {
+        virtual ~Executor() = default;
+        virtual void post(std::coroutine_handle<> handle) = 0;
+    };
+
+    /** Runs everything on the thread calling run(). post() is not thread safe: **/
+    class SingleThreadExecutor: public Executor
+    {
+        DVector<std::coroutine_handle<>> queue;
+
+    public:
+
+        void post(std::coroutine_handle<> handle) override {
+            queue.push_back(handle);
+        }
+
+        /** Resumes the queued coroutines until none is left, returns their number: **/
+        size_t run()
+        {
+            size_t count = 0;
+            for (; !queue.Empty(); ++count) {
+                const std::coroutine_handle<> handle = queue.Front();
+                queue.pop_front();
+                handle.resume();
+            }
+            return count;
+        }
+    };
+
+    class ThreadPoolExecutor: public Executor
+    {
+        std::mutex mutex;
+        std::condition_variable available;
+        DVector<std::coroutine_handle<>> queue;
+        bool stopped { false };
+        std::vector<std::jthread> workers;
+
+        void work()
+        {
+            while (true)
+            {
+                std::unique_lock lock { mutex };
+                available.wait(lock, [this] { return stopped || !queue.Empty(); });
+                if (queue.Empty())
+                    return;
+
+                const std::coroutine_handle<> handle = queue.Front();
+                queue.pop_front();
+                lock.unlock();
+                handle.resume();
+            }
+        }
+
+    public:
+
+        explicit ThreadPoolExecutor(const size_t threads = std::thread::hardware_concurrency())
+        {
+            for (size_t idx = 0; idx < std::max<size_t>(threads, 1); ++idx)
+                workers.emplace_back([this] { work(); });
+        }
+
+        /** Finishes the queued coroutines before joining the workers: **/
+        ~ThreadPoolExecutor() override
+        {
+            {
+                std::lock_guard lock { mutex };
+                stopped = true;
+            }
+            available.notify_all();
+            workers.clear();
+        }
+
+        void post(std::coroutine_handle<> handle) override
+        {
+            {
+                std::lock_guard lock { mutex };
+                queue.push_back(handle);
+            }
+            available.notify_one();
+        }
+    };
+
+    /** Minimal lazy coroutine: started by posting it to the executor, owns the frame. The frame may
+     *  be destroyed once Done() returns true. **/
+    class Task
+    {
+    public:
+
+        struct promise_type
+        {
+            std::atomic<bool> done { false };
+
+            struct FinalAwaiter
+            {
+                [[nodiscard]]
+                bool await_ready() const noexcept {
+                    return false;
+                }
+
+                void await_suspend(std::coroutine_handle<promise_type> handle) const noexcept {
+                    handle.promise().done.store(true, std::memory_order_release);
+                }
+
+                void await_resume() const noexcept {
+                }
+            };
+
+            Task get_return_object() noexcept {
+                return Task { std::coroutine_handle<promise_type>::from_promise(*this) };
+            }
+
+            std::suspend_always initial_suspend() const noexcept {
+                return {};
+            }
+
+            FinalAwaiter final_suspend() const noexcept {
+                return {};
+            }
+
+            void return_void() const noexcept {
+            }
+
+            void unhandled_exception() const noexcept {
+                std::terminate();
+            }
+        };
+
+    private:
+        std::coroutine_handle<promise_type> handle;
+
+        explicit Task(std::coroutine_handle<promise_type> coroutine) noexcept: handle { coroutine } {
+        }
+
+    public:
+
+        Task(Task&& other) noexcept: handle { std::exchange(other.handle, nullptr) } {
+        }
+
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+        Task& operator=(Task&&) = delete;
+
+        ~Task()
+        {
+            if (handle)
+                handle.destroy();
+        }
+
+        void Start(Executor& executor) {
+            executor.post(handle);
+        }
+
+        [[nodiscard]]
+        bool Done() const noexcept {
+            return handle.promise().done.load(std::memory_order_acquire);
+        }
+    };
+
+    /** Multi-producer multi-consumer channel. Items are queued in the DVector (no per-item allocation),
+     *  the suspended coroutines are linked through the awaiters living in their frames. An item sent
+     *  while a receiver is waiting is handed over directly, receive_many() drains up to n queued items
+     *  with a single lock and no suspension. With a non-zero bound the senders wait for the free slot. **/
+    template<typename Type>
+    class AsyncChannel
+    {
+        using object_type = Type;
+        using size_type = size_t;
+
+        struct ReceiveWaiter
+        {
+            std::coroutine_handle<> handle;
+            std::optional<object_type>* single { nullptr };
+            std::span<object_type> batch;
+            size_type count { 0 };
+
+            void deliver(object_type&& value)
+            {
+                if (nullptr != single)
+                    single->emplace(std::move(value));
+                else
+                    batch.front() = std::move(value);
+                count = 1;
+            }
+        };
+
+        struct SendWaiter
+        {
+            std::coroutine_handle<> handle;
+            object_type* value { nullptr };
+            bool accepted { false };
+        };
+
+    private:
+        Executor& executor;
+        size_type bound { 0 };
+
+        std::mutex mutex;
+        DVector<object_type> items;
+        DVector<ReceiveWaiter*> receivers;
+        DVector<SendWaiter*> senders;
+        bool closed { false };
+
+    private:
+
+        /** Under the lock: moves the values of the waiting senders into the 'count' freed slots: **/
+        void admitSenders(size_type count)
+        {
+            for (; count > 0 && !senders.Empty(); --count)
+            {
+                SendWaiter* sender = senders.Front();
+                senders.pop_front();
+                items.push_back(std::move(*sender->value));
+                sender->accepted = true;
+                executor.post(sender->handle);
+            }
+        }
+
+        /** Under the lock: gets the queued items into the waiter, returns false if it has to wait: **/
+        bool tryReceive(ReceiveWaiter& waiter)
+        {
+            if (!items.Empty())
+            {
+                if (nullptr != waiter.single) {
+                    waiter.single->emplace(std::move(items.Front()));
+                    waiter.count = 1;
+                } else {
+                    waiter.count = std::min(waiter.batch.size(), items.Size());
+                    std::move(items.begin(), items.begin() + waiter.count, waiter.batch.begin());
+                }
+                items.pop_front(waiter.count);
+                admitSenders(waiter.count);
+                return true;
+            }
+            return closed;
+        }
+
+    public:
+
+        class SendAwaiter
+        {
+            AsyncChannel& channel;
+            object_type value;
+            SendWaiter waiter;
+
+        public:
+
+            SendAwaiter(AsyncChannel& owner, object_type&& item): channel { owner }, value { std::move(item) } {
+            }
+
+            [[nodiscard]]
+            bool await_ready() const noexcept {
+                return false;
+            }
+
+            bool await_suspend(std::coroutine_handle<> handle)
+            {
+                std::lock_guard lock { channel.mutex };
+                if (channel.closed)
+                    return false;
+
+                waiter.accepted = true;
+                if (!channel.receivers.Empty()) {
+                    ReceiveWaiter* receiver = channel.receivers.Front();
+                    channel.receivers.pop_front();
+                    receiver->deliver(std::move(value));
+                    channel.executor.post(receiver->handle);
+                    return false;
+                }
+                if (0 == channel.bound || channel.items.Size() < channel.bound) {
+                    channel.items.push_back(std::move(value));
+                    return false;
+                }
+
+                waiter.accepted = false;
+                waiter.handle = handle;
+                waiter.value = &value;
+                channel.senders.push_back(&waiter);
+                return true;
+            }
+
+            /** False if the channel has been closed and the value dropped: **/
+            [[nodiscard]]
+            bool await_resume() const noexcept {
+                return waiter.accepted;
+            }
+        };
+
+        class ReceiveAwaiter
+        {
+            AsyncChannel& channel;
+            std::optional<object_type> value;
+            ReceiveWaiter waiter;
+
+        public:
+
+            explicit ReceiveAwaiter(AsyncChannel& owner): channel { owner } {
+                waiter.single = &value;
+            }
+
+            [[nodiscard]]
+            bool await_ready() const noexcept {
+                return false;
+            }
+
+            bool await_suspend(std::coroutine_handle<> handle)
+            {
+                std::lock_guard lock { channel.mutex };
+                if (channel.tryReceive(waiter))
+                    return false;
+                waiter.handle = handle;
+                channel.receivers.push_back(&waiter);
+                return true;
+            }
+
+            /** Empty once the channel is closed and drained: **/
+            [[nodiscard]]
+            std::optional<object_type> await_resume() {
+                return std::move(value);
+            }
+        };
+
+        class ReceiveManyAwaiter
+        {
+            AsyncChannel& channel;
+            ReceiveWaiter waiter;
+
+        public:
+
+            ReceiveManyAwaiter(AsyncChannel& owner, std::span<object_type> output): channel { owner } {
+                waiter.batch = output;
+            }
+
+            [[nodiscard]]
+            bool await_ready() const noexcept {
+                return waiter.batch.empty();
+            }
+
+            bool await_suspend(std::coroutine_handle<> handle)
+            {
+                std::lock_guard lock { channel.mutex };
+                if (channel.tryReceive(waiter))
+                    return false;
+                waiter.handle = handle;
+                channel.receivers.push_back(&waiter);
+                return true;
+            }
+
+            /** Number of the items written to the span, zero once the channel is closed and drained: **/
+            [[nodiscard]]
+            size_type await_resume() const noexcept {
+                return waiter.count;
+            }
+        };
+
+    public:
+
+        /** The 'capacity' of zero makes the channel unbounded: **/
+        explicit AsyncChannel(Executor& wakeupExecutor, const size_type capacity = 0):
+                executor { wakeupExecutor }, bound { capacity }, items (capacity > 0 ? 2 * capacity + 2 : 0) {
+        }
+
+        AsyncChannel(const AsyncChannel&) = delete;
+        AsyncChannel& operator=(const AsyncChannel&) = delete;
+
+        [[nodiscard]]
+        SendAwaiter send(object_type value) {
+            return SendAwaiter { *this, std::move(value) };
+        }
+
+        [[nodiscard]]
+        ReceiveAwaiter receive() {
+            return ReceiveAwaiter { *this };
+        }
+
+        [[nodiscard]]
+        ReceiveManyAwaiter receive_many(std::span<object_type> output) {
+            return ReceiveManyAwaiter { *this, output };
+        }
+
+        /** Wakes up all waiting coroutines: the senders get false, the receivers nothing: **/
+        void Close()
+        {
+            std::lock_guard lock { mutex };
+            closed = true;
+            for (; !receivers.Empty(); receivers.pop_front())
+                executor.post(receivers.Front()->handle);
+            for (; !senders.Empty(); senders.pop_front())
+                executor.post(senders.Front()->handle);
+        }
+
+        [[nodiscard]]
+        size_type Size()
+        {
+            std::lock_guard lock { mutex };
+            return items.Size();
+        }
+    };
+}
+
+#endif //CPPPROJECTS_ASYNCCHANNEL_H
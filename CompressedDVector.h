@@ -0,0 +1,254 @@
+/**============================================================================
+Name        : CompressedDVector.h
+Created on  : 19.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Delta + bit-packing compressed two-sided integer vector
+============================================================================**/
+
+#ifndef CPPPROJECTS_COMPRESSEDDVECTOR_H
+#define CPPPROJECTS_COMPRESSEDDVECTOR_H
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <numeric>
+#include "DVector.h"
+
+namespace DVector
+{
+    /** Integers are kept in the blocks of 'BlockSize' values: the first value of the block followed by
+     *  the zigzag encoded deltas bit-packed with the smallest width fitting all of them. The values
+     *  pushed to either end are collected in the open (uncompressed) head and tail blocks, which are
+     *  sealed into the two-sided word pool once full. **/
+    template<std::integral Int, size_t BlockSize = 128>
+    class CompressedDVector
+    {
+        using value_type = Int;
+        using unsigned_type = std::make_unsigned_t<Int>;
+        using word_type = uint64_t;
+        using size_type = size_t;
+
+        static_assert(BlockSize > 1, "Block should hold more than one value");
+
+        static constexpr size_type wordBits { std::numeric_limits<word_type>::digits };
+        static constexpr size_type valueBits { std::numeric_limits<unsigned_type>::digits };
+        static constexpr size_type maxBlockWords { ((BlockSize - 1) * valueBits + wordBits - 1) / wordBits };
+
+        struct Block
+        {
+            /** First value of the block: **/
+            value_type base { 0 };
+
+            /** Position of the first word, the pool index is 'position + origin': **/
+            std::ptrdiff_t position { 0 };
+
+            /** Bits per delta: **/
+            uint8_t width { 0 };
+        };
+
+    private:
+        /** Bit-packed deltas of all sealed blocks: **/
+        DVector<word_type> pool;
+
+        /** Number of the words ever prepended to the pool: **/
+        std::ptrdiff_t origin { 0 };
+
+        DVector<Block> blocks;
+
+        /** Open blocks at both ends: **/
+        DVector<value_type> head;
+        DVector<value_type> tail;
+
+    private:
+
+        [[nodiscard]]
+        static constexpr unsigned_type zigzag(unsigned_type delta) noexcept {
+            return (delta << 1) ^ static_cast<unsigned_type>(-(delta >> (valueBits - 1)));
+        }
+
+        [[nodiscard]]
+        static constexpr unsigned_type unzigzag(unsigned_type value) noexcept {
+            return (value >> 1) ^ static_cast<unsigned_type>(-(value & 1));
+        }
+
+        [[nodiscard]]
+        static constexpr size_type wordsCount(uint8_t width) noexcept {
+            return ((BlockSize - 1) * width + wordBits - 1) / wordBits;
+        }
+
+        /** Encodes the full open block, returns the block with the position not set yet: **/
+        [[nodiscard]]
+        static Block encode(const DVector<value_type>& values, std::array<word_type, maxBlockWords>& words)
+        {
+            std::array<unsigned_type, BlockSize> encoded {};
+            unsigned_type any = 0;
+            for (size_type idx = 1; idx < BlockSize; ++idx) {
+                encoded[idx] = zigzag(static_cast<unsigned_type>(values[idx]) - static_cast<unsigned_type>(values[idx - 1]));
+                any |= encoded[idx];
+            }
+
+            const auto width = static_cast<uint8_t>(std::bit_width(any));
+            words.fill(0);
+            for (size_type idx = 1, bit = 0; idx < BlockSize && 0 != width; ++idx, bit += width)
+            {
+                const auto value = static_cast<word_type>(encoded[idx]);
+                const size_type word = bit / wordBits, shift = bit % wordBits;
+                words[word] |= value << shift;
+                if (shift + width > wordBits)
+                    words[word + 1] |= value >> (wordBits - shift);
+            }
+            return Block { values[0], 0, width };
+        }
+
+        /** Decodes the sealed block into the 'values': unpack, undo the zigzag, then the prefix sum: **/
+        void decode(const Block& block, value_type* values, size_type count = BlockSize) const
+        {
+            std::array<unsigned_type, BlockSize> deltas {};
+            if (0 != block.width)
+            {
+                const word_type* words = pool.Data() + (block.position + origin);
+                const word_type mask = block.width == wordBits ? ~word_type { 0 } : (word_type { 1 } << block.width) - 1;
+                for (size_type idx = 1, bit = 0; idx < count; ++idx, bit += block.width)
+                {
+                    const size_type word = bit / wordBits, shift = bit % wordBits;
+                    word_type value = words[word] >> shift;
+                    if (shift + block.width > wordBits)
+                        value |= words[word + 1] << (wordBits - shift);
+                    deltas[idx] = static_cast<unsigned_type>(value & mask);
+                }
+            }
+
+            deltas[0] = static_cast<unsigned_type>(block.base);
+            for (size_type idx = 1; idx < count; ++idx)
+                deltas[idx] = unzigzag(deltas[idx]);
+            std::inclusive_scan(deltas.begin(), deltas.begin() + count, deltas.begin());
+            for (size_type idx = 0; idx < count; ++idx)
+                values[idx] = static_cast<value_type>(deltas[idx]);
+        }
+
+        void sealTail()
+        {
+            std::array<word_type, maxBlockWords> words;
+            Block block = encode(tail, words);
+            block.position = static_cast<std::ptrdiff_t>(pool.Size()) - origin;
+            for (size_type idx = 0; idx < wordsCount(block.width); ++idx)
+                pool.push_back(words[idx]);
+            blocks.push_back(block);
+            tail.Clear();
+        }
+
+        void sealHead()
+        {
+            std::array<word_type, maxBlockWords> words;
+            Block block = encode(head, words);
+            const size_type count = wordsCount(block.width);
+            for (size_type idx = count; idx > 0; --idx)
+                pool.push_front(words[idx - 1]);
+            origin += static_cast<std::ptrdiff_t>(count);
+            block.position = -origin;
+            blocks.push_front(block);
+            head.Clear();
+        }
+
+    public:
+
+        CompressedDVector():
+                head (2 * BlockSize + 2), tail (2 * BlockSize + 2) {
+        }
+
+        [[nodiscard]]
+        inline size_type Size() const noexcept {
+            return head.Size() + blocks.Size() * BlockSize + tail.Size();
+        }
+
+        [[nodiscard]]
+        inline bool Empty() const noexcept {
+            return 0 == Size();
+        }
+
+        /** Bytes reserved by the compressed storage and the open blocks: **/
+        [[nodiscard]]
+        size_type MemoryUsage() const noexcept
+        {
+            return pool.Capacity() * sizeof(word_type) + blocks.Capacity() * sizeof(Block) +
+                   (head.Capacity() + tail.Capacity()) * sizeof(value_type);
+        }
+
+        /** Releases the spare capacity of the compressed storage: **/
+        void ShrinkToFit()
+        {
+            pool.ShrinkToFit();
+            blocks.ShrinkToFit();
+        }
+
+        void push_back(value_type value)
+        {
+            tail.push_back(value);
+            if (BlockSize == tail.Size())
+                sealTail();
+        }
+
+        void push_front(value_type value)
+        {
+            head.push_front(value);
+            if (BlockSize == head.Size())
+                sealHead();
+        }
+
+        /** Skips to the block holding the value and decodes only its prefix: **/
+        [[nodiscard]]
+        value_type operator[] (size_type index) const
+        {
+            if (index < head.Size())
+                return head[index];
+
+            index -= head.Size();
+            if (const size_type blockIndex = index / BlockSize; blockIndex < blocks.Size())
+            {
+                std::array<value_type, BlockSize> values;
+                decode(blocks[blockIndex], values.data(), index % BlockSize + 1);
+                return values[index % BlockSize];
+            }
+            return tail[index - blocks.Size() * BlockSize];
+        }
+
+        [[nodiscard]]
+        value_type at(size_type index) const
+        {
+            if (index >= Size())
+                throw std::out_of_range(std::format("{} index is out of range", index));
+            return (*this)[index];
+        }
+
+        /** Sequential scan, the sealed blocks are decoded one at a time: **/
+        template<typename Callback>
+        void forEach(Callback&& callback) const
+        {
+            for (const value_type value: head)
+                callback(value);
+
+            std::array<value_type, BlockSize> values;
+            for (const Block& block: blocks) {
+                decode(block, values.data());
+                for (const value_type value: values)
+                    callback(value);
+            }
+
+            for (const value_type value: tail)
+                callback(value);
+        }
+
+        void Clear() noexcept
+        {
+            pool.Clear();
+            blocks.Clear();
+            head.Clear();
+            tail.Clear();
+            origin = 0;
+        }
+    };
+}
+
+#endif //CPPPROJECTS_COMPRESSEDDVECTOR_H
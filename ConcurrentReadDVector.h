@@ -0,0 +1,320 @@
+/**============================================================================
+Name        : ConcurrentReadDVector.h
+Created on  : 19.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Single writer / many readers DVector with epoch based reclamation
+============================================================================**/
+
+#ifndef CPPPROJECTS_CONCURRENTREADDVECTOR_H
+#define CPPPROJECTS_CONCURRENTREADDVECTOR_H
+
+#include <atomic>
+#include <array>
+#include <thread>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include "DVector.h"
+
+namespace DVector
+{
+    /** One writer thread may call push_back()/push_front(), any number of threads may read through
+     *  a Snapshot. Readers only load the block pointer and the two indices, the buffers replaced by
+     *  the growth are retired and freed once no reader which could observe them is active. **/
+    template<typename Type,
+            typename Allocator = Allocator<Type>,
+            size_t MaxReaders = 128>
+    class ConcurrentReadDVector
+    {
+        using object_type = Type;
+        using pointer = object_type*;
+        using size_type = size_t;
+        using epoch_type = uint64_t;
+
+        static_assert(MaxReaders > 0, "At least one reader slot is required");
+
+        static constexpr size_type initialCapacity { 10 };
+        static constexpr size_type growthFactor { 4 };
+
+        /** Storage generation. Replaced as a whole by the writer, never resized in place: **/
+        struct Block
+        {
+            pointer data { nullptr };
+            size_type capacity { 0 };
+
+            std::atomic<size_type> left { 0 };
+            std::atomic<size_type> right { 0 };
+
+            /** Writer-only bookkeeping of the retired blocks: **/
+            Block* nextRetired { nullptr };
+            epoch_type retireEpoch { 0 };
+        };
+
+        /** Epoch the reader entered with, zero for the free slot: **/
+        struct alignas(cacheLineSize) ReaderSlot
+        {
+            std::atomic<epoch_type> epoch { 0 };
+        };
+
+    private:
+        std::atomic<Block*> current { nullptr };
+
+        alignas(cacheLineSize) std::atomic<epoch_type> epoch { 1 };
+
+        mutable std::array<ReaderSlot, MaxReaders> readers {};
+
+        /** Blocks waiting for the readers to leave, owned by the writer: **/
+        Block* retired { nullptr };
+
+        Allocator allocator;
+
+    public:
+
+        /** Consistent read-only view of the vector, pins the block it was taken from: **/
+        class Snapshot
+        {
+            friend class ConcurrentReadDVector;
+
+            ReaderSlot* slot { nullptr };
+            const Block* block { nullptr };
+            size_type left { 0 };
+            size_type right { 0 };
+
+            Snapshot(ReaderSlot* readerSlot, const Block* readerBlock) noexcept:
+                    slot { readerSlot }, block { readerBlock },
+                    left { readerBlock->left.load(std::memory_order_acquire) },
+                    right { readerBlock->right.load(std::memory_order_acquire) } {
+            }
+
+        public:
+
+            Snapshot(const Snapshot&) = delete;
+            Snapshot& operator=(const Snapshot&) = delete;
+
+            Snapshot(Snapshot&& other) noexcept:
+                    slot { std::exchange(other.slot, nullptr) }, block { other.block },
+                    left { other.left }, right { other.right } {
+            }
+
+            Snapshot& operator=(Snapshot&&) = delete;
+
+            ~Snapshot()
+            {
+                if (nullptr != slot)
+                    slot->epoch.store(0, std::memory_order_release);
+            }
+
+            [[nodiscard]]
+            const object_type& Front() const noexcept {
+                return block->data[left + 1];
+            }
+
+            [[nodiscard]]
+            const object_type& Back() const noexcept {
+                return block->data[right - 1];
+            }
+
+            [[nodiscard]]
+            const object_type& operator[] (size_type index) const noexcept {
+                return block->data[index + left + 1];
+            }
+
+            [[nodiscard]]
+            const object_type& at(size_type index) const {
+                if (index >= Size())
+                    throw std::out_of_range(std::format("{} index is out of range", index));
+                return block->data[index + left + 1];
+            }
+
+            [[nodiscard]]
+            inline size_type Size() const noexcept {
+                return right - left - 1;
+            }
+
+            [[nodiscard]]
+            inline bool Empty() const noexcept {
+                return 1 == (right - left);
+            }
+
+            [[nodiscard]]
+            inline const object_type* Data() const noexcept {
+                return block->data + left + 1;
+            }
+
+            [[nodiscard]]
+            inline const object_type* begin() const noexcept {
+                return Data();
+            }
+
+            [[nodiscard]]
+            inline const object_type* end() const noexcept {
+                return block->data + right;
+            }
+        };
+
+    private:
+
+        Block* makeBlock(size_type capacity)
+        {
+            Block* block = new Block {};
+            block->data = allocator.allocate(capacity);
+            block->capacity = capacity;
+            return block;
+        }
+
+        void freeBlock(Block* block)
+        {
+            const size_type left = block->left.load(std::memory_order_relaxed);
+            std::destroy_n(block->data + left + 1, block->right.load(std::memory_order_relaxed) - left - 1);
+            allocator.deallocate(block->data, block->capacity);
+            delete block;
+        }
+
+        /** Writer only. The old block stays readable, elements are copied and not moved: **/
+        Block* growVector(Block* block)
+        {
+            const size_type left = block->left.load(std::memory_order_relaxed);
+            const size_type right = block->right.load(std::memory_order_relaxed);
+            const size_type size = right - left - 1;
+            const size_type left_center_dist = block->capacity / 2 - left - 1;
+
+            Block* newBlock = makeBlock(block->capacity * growthFactor);
+            const size_type newLeft = newBlock->capacity / 2 - left_center_dist - 1;
+            std::uninitialized_copy_n(block->data + left + 1, size, newBlock->data + newLeft + 1);
+            newBlock->left.store(newLeft, std::memory_order_relaxed);
+            newBlock->right.store(newLeft + size + 1, std::memory_order_relaxed);
+
+            current.store(newBlock, std::memory_order_seq_cst);
+
+            /** Readers entered with an epoch below this one may still hold the old block: **/
+            block->retireEpoch = epoch.fetch_add(1, std::memory_order_seq_cst) + 1;
+            block->nextRetired = retired;
+            retired = block;
+
+            Reclaim();
+            return newBlock;
+        }
+
+        [[nodiscard]]
+        ReaderSlot& acquireSlot(epoch_type readerEpoch) const
+        {
+            static thread_local const size_type hint = std::hash<std::thread::id>{}(std::this_thread::get_id());
+            while (true)
+            {
+                for (size_type idx = 0; idx < MaxReaders; ++idx)
+                {
+                    ReaderSlot& slot = readers[(hint + idx) % MaxReaders];
+                    epoch_type expected = 0;
+                    if (slot.epoch.load(std::memory_order_relaxed) == 0 &&
+                        slot.epoch.compare_exchange_strong(expected, readerEpoch, std::memory_order_seq_cst))
+                        return slot;
+                }
+                std::this_thread::yield();
+            }
+        }
+
+    public:
+
+        explicit ConcurrentReadDVector(const size_type s = initialCapacity)
+        {
+            /** At least two slots, so that the left index of the empty block does not underflow: **/
+            Block* block = makeBlock(std::max<size_type>(s > 0 ? s : initialCapacity, 2));
+            block->right.store(block->capacity / 2, std::memory_order_relaxed);
+            block->left.store(block->capacity / 2 - 1, std::memory_order_relaxed);
+            current.store(block, std::memory_order_release);
+        }
+
+        ~ConcurrentReadDVector()
+        {
+            freeBlock(current.load(std::memory_order_relaxed));
+            while (nullptr != retired)
+                freeBlock(std::exchange(retired, retired->nextRetired));
+        }
+
+        ConcurrentReadDVector(const ConcurrentReadDVector&) = delete;
+        ConcurrentReadDVector& operator=(const ConcurrentReadDVector&) = delete;
+
+    public:
+
+        /** Safe to call from any thread: **/
+        [[nodiscard]]
+        Snapshot Read() const
+        {
+            ReaderSlot& slot = acquireSlot(epoch.load(std::memory_order_seq_cst));
+            return Snapshot { &slot, current.load(std::memory_order_seq_cst) };
+        }
+
+        [[nodiscard]]
+        size_type Size() const noexcept
+        {
+            const Block* block = current.load(std::memory_order_acquire);
+            return block->right.load(std::memory_order_acquire) - block->left.load(std::memory_order_acquire) - 1;
+        }
+
+        [[nodiscard]]
+        size_type Capacity() const noexcept {
+            return current.load(std::memory_order_acquire)->capacity;
+        }
+
+        /** Number of the replaced blocks still waiting for the readers: **/
+        [[nodiscard]]
+        size_type RetiredCount() const noexcept
+        {
+            size_type count = 0;
+            for (const Block* block = retired; nullptr != block; block = block->nextRetired)
+                ++count;
+            return count;
+        }
+
+        /** Writer only: frees the retired blocks no active reader can observe anymore. **/
+        void Reclaim()
+        {
+            epoch_type minActive = std::numeric_limits<epoch_type>::max();
+            for (const ReaderSlot& slot: readers)
+                if (const epoch_type readerEpoch = slot.epoch.load(std::memory_order_seq_cst); 0 != readerEpoch)
+                    minActive = std::min(minActive, readerEpoch);
+
+            Block** link = &retired;
+            while (nullptr != *link)
+            {
+                Block* block = *link;
+                if (block->retireEpoch <= minActive) {
+                    *link = block->nextRetired;
+                    freeBlock(block);
+                } else {
+                    link = &block->nextRetired;
+                }
+            }
+        }
+
+        /** Writer only: **/
+        void push_back(const object_type& v)
+        {
+            Block* block = current.load(std::memory_order_relaxed);
+            size_type right = block->right.load(std::memory_order_relaxed);
+            if (right >= block->capacity) {
+                block = growVector(block);
+                right = block->right.load(std::memory_order_relaxed);
+            }
+            std::construct_at(block->data + right, v);
+            block->right.store(right + 1, std::memory_order_release);
+        }
+
+        /** Writer only: **/
+        void push_front(const object_type& v)
+        {
+            Block* block = current.load(std::memory_order_relaxed);
+            size_type left = block->left.load(std::memory_order_relaxed);
+            if (0 >= left) {
+                block = growVector(block);
+                left = block->left.load(std::memory_order_relaxed);
+            }
+            std::construct_at(block->data + left, v);
+            block->left.store(left - 1, std::memory_order_release);
+        }
+    };
+}
+
+#endif //CPPPROJECTS_CONCURRENTREADDVECTOR_H
@@ -13,38 +13,108 @@ Description : DVector.h
 #include <memory>
 #include <algorithm>
 #include <format>
+#include <ranges>
+#include <utility>
+#include <stdexcept>
+#include <bit>
+#include <limits>
+#include <functional>
+#include <span>
+#include <concepts>
+
+/** Optional USDT probes (provider 'dvector') for perf / bpftrace. Without DVECTOR_USDT they
+ *  compile to nothing, with it each probe is a single nop until a tracer attaches: **/
+#if defined(DVECTOR_USDT)
+#include <sys/sdt.h>
+#define DVECTOR_PROBE(name, ...) STAP_PROBEV(dvector, name, __VA_ARGS__)
+#else
+#define DVECTOR_PROBE(name, ...) static_cast<void>(0)
+#endif
 
 namespace DVector
 {
-    template<typename _Ty>
+    /** Size of the cache line used for the padding and as the default SIMD friendly alignment: **/
+    inline constexpr size_t cacheLineSize { 64 };
+
+    /** Allocates raw (not constructed) storage aligned to the 'Alignment' bytes: **/
+    template<typename _Ty, size_t Alignment = alignof(_Ty)>
     struct Allocator: std::allocator<_Ty>
     {
+        static_assert(Alignment >= alignof(_Ty) && 0 == (Alignment & (Alignment - 1)),
+                      "Alignment must be a power of two not less than the alignment of the type");
+
+        static constexpr size_t alignment { Alignment };
+
+        template<typename _Other>
+        struct rebind {
+            using other = Allocator<_Other, std::max(Alignment, alignof(_Other))>;
+        };
+
         _Ty* allocate(size_t size)
         {
-            return new _Ty[size];
+            if constexpr (Alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+                return static_cast<_Ty*>(::operator new(size * sizeof(_Ty), std::align_val_t { Alignment }));
+            else
+                return static_cast<_Ty*>(::operator new(size * sizeof(_Ty)));
         }
 
         void deallocate(_Ty* ptr, size_t)
         {
-            delete[] ptr;
+            if constexpr (Alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+                ::operator delete(ptr, std::align_val_t { Alignment });
+            else
+                ::operator delete(ptr);
         }
     };
 
+    /** Tag selecting the default initialization (no value initialization) of the new elements: **/
+    struct default_init_t
+    {
+        explicit default_init_t() = default;
+    };
 
+    inline constexpr default_init_t default_init {};
+
+    /** Keeps the objects stored in per-thread arrays on separate cache lines (no false sharing): **/
+    template<typename _Ty>
+    struct alignas(cacheLineSize) CacheLinePadded: _Ty
+    {
+        using _Ty::_Ty;
+    };
 
+    /** 'SizeType' is the type of the capacity and both indices. The narrow ones (uint32_t, uint16_t)
+     *  shrink the object itself, the growth beyond the range they can address throws std::length_error. **/
     template<typename Type,
-            typename Allocator = Allocator<Type>>
+            typename Allocator = Allocator<Type>,
+            std::unsigned_integral SizeType = size_t>
     class DVector
     {
         using object_type = Type;
         using pointer = object_type*;
-        using size_type = size_t;
+        using size_type = SizeType;
 
         static_assert(!std::is_same_v<object_type, void>,
                       "Type of the Objects in the pool can not be void");
 
-        static constexpr size_type initialCapacity { 10 };
-        static constexpr size_type growthFactor { 4 };
+        static constexpr size_t initialCapacity { 10 };
+        static constexpr size_t growthFactor { 4 };
+
+        /** Largest capacity the indices can address (the right index may reach the capacity): **/
+        static constexpr size_t maxCapacity {
+            std::min<size_t>(std::numeric_limits<size_type>::max(), std::numeric_limits<std::ptrdiff_t>::max() / sizeof(object_type)) };
+
+        static constexpr size_t alignment = [] {
+            if constexpr (requires { Allocator::alignment; })
+                return std::max<size_t>(Allocator::alignment, alignof(object_type));
+            return alignof(object_type);
+        }();
+
+        /** Number of the elements between two alignment boundaries, the first element is kept on one: **/
+        static constexpr size_t alignmentStride =
+                alignment > sizeof(object_type) && 0 == alignment % sizeof(object_type) ? alignment / sizeof(object_type) : 1;
+
+        /** Smallest block: a slot on each side, or two strides so that an aligned element has room: **/
+        static constexpr size_t minCapacity { 1 == alignmentStride ? 2 : 2 * alignmentStride };
 
     private:
         /** Elements collection block: **/
@@ -57,28 +127,92 @@ namespace DVector
         size_type left { 0 };
         size_type right { 0 };
 
-        /** The allocator to use for allocating and deallocating chunks: **/
-        Allocator allocator;
+        /** The allocator to use for allocating and deallocating chunks, takes no room if stateless: **/
+        [[no_unique_address]] Allocator allocator;
 
     private:
 
-        void growVector()
+        /** Moves the elements into the new block of 'newCapacity' elements, 'newLeft' becomes the new left index.
+         *  Every regrow passes here (growVector, Reserve, ShrinkToFit, prepare / append / resize), probes:
+         *  'grow_entry' (vector, capacity, size), 'grow_exit' (vector, old capacity, new capacity, size, bytes moved): **/
+        void reallocate(const size_type newCapacity, const size_type newLeft)
         {
-            // std::cout << "* * * * ReAlloc (" << capacity << " ==> " << capacity * growthFactor << ") * * * * \n";
+            const size_type size = right - left - 1;
+            [[maybe_unused]] const size_type oldCapacity = capacity;
+            DVECTOR_PROBE(grow_entry, this, capacity, size);
+
+            pointer newData { allocator.allocate(newCapacity) };
+            std::uninitialized_move_n(data + left + 1, size, newData + newLeft + 1);
+            std::swap(data, newData);
+
+            std::destroy_n(newData + left + 1, size);
+            allocator.deallocate(newData, capacity);
 
+            capacity = newCapacity;
+            left = newLeft;
+            right = left + size + 1;
+            DVECTOR_PROBE(grow_exit, this, oldCapacity, capacity, size, size * sizeof(object_type));
+        }
+
+        /** Left index putting the elements in the middle of the current block: **/
+        [[nodiscard]]
+        size_type centeredLeft() const noexcept
+        {
+            const size_type size = right - left - 1;
+            return alignedLeft((capacity - size - 1) / 2, size, capacity);
+        }
+
+        /** Moves the elements to the middle of the same block, leaving equal room on both sides. Probes:
+         *  'recenter_entry' (vector, capacity, size), 'recenter_exit' (vector, capacity, size, bytes moved): **/
+        void recenter()
+        {
             const size_type size = right - left - 1;
-            const size_type left_old = left, left_center_dist = capacity / 2 - left - 1;
+            const size_type newLeft = centeredLeft();
+            DVECTOR_PROBE(recenter_entry, this, capacity, size);
+
+            if (newLeft < left) {
+                for (size_type idx = 0; idx < size; ++idx) {
+                    std::construct_at(data + newLeft + 1 + idx, std::move(data[left + 1 + idx]));
+                    std::destroy_at(data + left + 1 + idx);
+                }
+            } else if (newLeft > left) {
+                for (size_type idx = size; idx > 0; --idx) {
+                    std::construct_at(data + newLeft + idx, std::move(data[left + idx]));
+                    std::destroy_at(data + left + idx);
+                }
+            }
 
-            capacity *= growthFactor;
-            left = capacity / 2 - left_center_dist  - 1;
+            DVECTOR_PROBE(recenter_exit, this, capacity, size, newLeft == left ? 0 : size * sizeof(object_type));
+            left = newLeft;
             right = left + size + 1;
+        }
 
-            pointer newData { allocator.allocate(capacity) };
-            std::uninitialized_move_n(data + left_old + 1, size, newData + left + 1);
-            std::swap(data, newData);
+        void growVector()
+        {
+            // std::cout << "* * * * ReAlloc (" << capacity << " ==> " << capacity * growthFactor << ") * * * * \n";
 
-            std::destroy_n(newData + left_old + 1, size);
-            allocator.deallocate(newData, capacity);
+            /** Queue-like usage (push on one side, pop on the other) only needs to re-center. Unless
+             *  the aligned middle position leaves a side still full (small blocks with a wide stride): **/
+            if (right - left < capacity / 2) {
+                if (const size_type newLeft = centeredLeft(); newLeft > 0 && newLeft + (right - left) < capacity) {
+                    recenter();
+                    return;
+                }
+            }
+
+            if (capacity >= maxCapacity)
+                throw std::length_error(std::format("DVector can not grow beyond {} elements", maxCapacity));
+
+            /** Close to the limit the block grows less and the elements are centered in it: **/
+            if (capacity > maxCapacity / growthFactor) {
+                const size_type size = right - left - 1;
+                reallocate(maxCapacity, alignedLeft((maxCapacity - size - 1) / 2, size, maxCapacity));
+                return;
+            }
+
+            /** Keeps the offset of the elements from the center, the left index may be past it: **/
+            const size_type newCapacity = capacity * growthFactor;
+            reallocate(newCapacity, alignedLeft(newCapacity / 2 - capacity / 2 + left, right - left - 1, newCapacity));
         }
 
         void destroy()
@@ -89,17 +223,84 @@ namespace DVector
             std::destroy_n(data + left + 1, size);
         }
 
+        /** Sum of the capacity parts, throws std::length_error if the size_type can not address it: **/
+        template<std::unsigned_integral ... Parts>
+        [[nodiscard]]
+        static size_type checkedCapacity(const Parts... parts)
+        {
+            size_t total = 0;
+            for (const size_t part: { static_cast<size_t>(parts)... }) {
+                if (part > maxCapacity - total)
+                    throw std::length_error(std::format("DVector can not hold more than {} elements", maxCapacity));
+                total += part;
+            }
+            return static_cast<size_type>(total);
+        }
+
+        /** Moves the proposed left index down (or up if there is no room) to put the first element on
+         *  the alignment boundary. Returns the proposed one when 'size' elements do not fit aligned: **/
+        [[nodiscard]]
+        static constexpr size_t alignedLeft(const size_t proposedLeft,
+                                            const size_t size,
+                                            const size_t blockCapacity) noexcept
+        {
+            if constexpr (1 == alignmentStride) {
+                return proposedLeft;
+            } else {
+                size_t first = (proposedLeft + 1) / alignmentStride * alignmentStride;
+                if (0 == first)
+                    first = alignmentStride;
+                return first + size <= blockCapacity ? first - 1 : proposedLeft;
+            }
+        }
+
+        /** Smallest left index not less than the proposed one putting the first element on the boundary: **/
+        [[nodiscard]]
+        static constexpr size_t alignedLeftUp(const size_t proposedLeft) noexcept {
+            return (proposedLeft + alignmentStride) / alignmentStride * alignmentStride - 1;
+        }
+
+        /** Room to reserve on the side short of 'count' slots. Follows the growth factor, so that
+         *  a loop of small prepare calls reallocates O(log n) times instead of on every call: **/
+        [[nodiscard]]
+        size_t grownRoom(const size_t count) const noexcept
+        {
+            constexpr size_t factor = growthFactor - 1;
+            return std::max<size_t>(count, std::min<size_t>(capacity, (maxCapacity - capacity) / factor) * factor);
+        }
+
+        template<typename Range>
+        static constexpr size_t rangeSizeHint(Range& range)
+        {
+            if constexpr (std::ranges::sized_range<Range>)
+                return std::ranges::size(range);
+            return 0;
+        }
+
     public:
 
-        explicit DVector(const size_type s = initialCapacity)
+        explicit DVector(const size_t s = initialCapacity)
         {
-            capacity = s > 0 ? s : initialCapacity;
+            capacity = checkedCapacity(std::max<size_t>(s > 0 ? s : initialCapacity, minCapacity));
             data = allocator.allocate(capacity);
 
             right = capacity / 2;
-            left = right - 1;   // TODO: check right > 1 ??
+            left = alignedLeft(right - 1, 0, capacity);
+            right = left + 1;
         }
 
+#if defined(__cpp_lib_containers_ranges)
+        /** Sized ranges are placed with the exact back capacity, others grow while being consumed: **/
+        template<std::ranges::input_range Range>
+        DVector(std::from_range_t, Range&& range):
+                DVector(initialCapacity + rangeSizeHint(range))
+        {
+            left = alignedLeft(initialCapacity / 2 - 1, 0, capacity);
+            right = left + 1;
+            append_from(std::forward<Range>(range));
+        }
+#endif
+
         ~DVector()
         {
             if (0 == capacity)
@@ -112,14 +313,15 @@ namespace DVector
             allocator.deallocate(data, capacity);
         }
 
-        DVector(const DVector<object_type, Allocator>& other):
+        DVector(const DVector& other):
                 capacity { other.capacity }, left { other.left } , right { other.right }
         {
             data = allocator.allocate(other.capacity);
-            std::copy_n(other.data + left + 1, right - left - 1, data + left + 1);
+            std::uninitialized_copy_n(other.data + left + 1, right - left - 1, data + left + 1);
+            DVECTOR_PROBE(copy, this, &other, capacity, right - left - 1);
         }
 
-        DVector(DVector<object_type, Allocator>&& other) noexcept:
+        DVector(DVector&& other) noexcept:
                 data { std::exchange(other.data, nullptr) },
                 capacity { std::exchange(other.capacity, 0) },
                 left { std::exchange(other.left, 0) },
@@ -127,7 +329,7 @@ namespace DVector
             /** **/
         }
 
-        DVector<object_type, Allocator>& operator=(const DVector<object_type, Allocator>& other)
+        DVector& operator=(const DVector& other)
         {
             if (&other != this) {
                 DVector localCopy(other);
@@ -136,14 +338,12 @@ namespace DVector
             return *this;
         }
 
-        DVector<object_type, Allocator>& operator=(DVector<object_type, Allocator>&& other) noexcept
+        DVector& operator=(DVector&& other) noexcept
         {
             if (&other != this)
             {
-                data = std::exchange(other.data, nullptr);
-                capacity = std::exchange(other.capacity, 0);
-                left = std::exchange(other.left, 0);
-                right = std::exchange(other.right, 0);
+                DVector localCopy(std::move(other));
+                DVector::swap(localCopy, *this);
             }
             return *this;
         }
@@ -202,20 +402,108 @@ namespace DVector
             return data + left + 1;
         }
 
+        [[nodiscard]]
+        inline pointer begin() const noexcept {
+            return data + left + 1;
+        }
+
+        [[nodiscard]]
+        inline pointer end() const noexcept {
+            return data + right;
+        }
+
         inline void Clear() noexcept
         {
+            DVECTOR_PROBE(clear, this, capacity, right - left - 1);
+
             /** Invoke destructors for all contained objects: **/
             destroy();
 
-            right = capacity / 2;
-            left = right - 1;
+            left = alignedLeft(capacity / 2 - 1, 0, capacity);
+            right = left + 1;
+        }
+
+        /** Makes room for 'front' push_front() and 'back' push_back() calls without reallocation: **/
+        void Reserve(const size_t front, const size_t back)
+        {
+            if (left >= front && BackCapacity() >= back)
+                return;
+
+            const size_type newLeft = checkedCapacity(alignedLeftUp(std::max<size_t>(left, checkedCapacity(front))));
+            reallocate(checkedCapacity(newLeft, Size(), std::max<size_t>(BackCapacity(), back), 1U), newLeft);
+        }
+
+        /** Releases the unused capacity on both sides, keeping at least the constructor minimum: **/
+        void ShrinkToFit()
+        {
+            const size_type newLeft = alignedLeftUp(0);
+            reallocate(std::max<size_type>(checkedCapacity(newLeft, Size(), 2U), minCapacity), newLeft);
+        }
+
+        /** Dynamic buffer interface: returns 'count' writable slots right after the last element.
+         *  Only the slots passed to commit_back() become the elements, the next push_back(),
+         *  reservation or prepare call invalidates the span: **/
+        [[nodiscard]]
+        std::span<object_type> prepare_back(const size_type count) requires std::is_trivial_v<object_type>
+        {
+            if (BackCapacity() < count)
+                Reserve(0, grownRoom(count));
+            return { data + right, count };
+        }
+
+        void commit_back(const size_type count) noexcept requires std::is_trivial_v<object_type> {
+            right += count;
+        }
+
+        /** Returns 'count' writable slots right before the first element. The data has to be
+         *  written to the end of the span, commit_front() takes the last 'count' slots: **/
+        [[nodiscard]]
+        std::span<object_type> prepare_front(const size_type count) requires std::is_trivial_v<object_type>
+        {
+            if (left < count)
+                Reserve(grownRoom(count), 0);
+            return { data + left + 1 - count, count };
+        }
+
+        void commit_front(const size_type count) noexcept requires std::is_trivial_v<object_type> {
+            left -= count;
+        }
+
+        /** Appends all elements of the range in one pass, input-only ranges and generators included: **/
+        template<std::ranges::input_range Range>
+        void append_from(Range&& range)
+        {
+            if constexpr (std::ranges::sized_range<Range>)
+                Reserve(0, std::ranges::size(range));
+
+            for (auto&& value: range)
+                push_back(std::forward<decltype(value)>(value));
+        }
+
+        /** Prepends all elements of the range keeping their order: **/
+        template<std::ranges::input_range Range>
+        void prepend_from(Range&& range)
+        {
+            if constexpr (std::ranges::sized_range<Range>)
+                Reserve(std::ranges::size(range), 0);
+
+            if constexpr (std::ranges::bidirectional_range<Range> && std::ranges::common_range<Range>) {
+                for (auto&& value: std::ranges::subrange(std::ranges::begin(range), std::ranges::end(range)) | std::views::reverse)
+                    push_front(std::forward<decltype(value)>(value));
+            } else {
+                /** Single pass: push everything to the front and restore the order afterwards: **/
+                const size_type sizeBefore = Size();
+                for (auto&& value: range)
+                    push_front(std::forward<decltype(value)>(value));
+                std::reverse(data + left + 1, data + left + 1 + (Size() - sizeBefore));
+            }
         }
 
         object_type& push_back(const object_type& v)
         {
             if (right >= capacity)
                 growVector();
-            this->data[right] = v;
+            std::construct_at(data + right, v);
             return data[right++];
         }
 
@@ -223,7 +511,7 @@ namespace DVector
         {
             if (right >= capacity)
                 growVector();
-            this->data[right] = std::move(v);
+            std::construct_at(data + right, std::move(v));
             return data[right++];
         }
 
@@ -231,7 +519,7 @@ namespace DVector
         {
             if (0 >= left)
                 growVector();
-            this->data[left] = v;
+            std::construct_at(data + left, v);
             return data[left--];
         }
 
@@ -239,7 +527,7 @@ namespace DVector
         {
             if (0 >= left)
                 growVector();
-            this->data[left] = std::move(v);
+            std::construct_at(data + left, std::move(v));
             return data[left--];
         }
 
@@ -253,6 +541,107 @@ namespace DVector
             data[++left].~object_type();
         }
 
+        /** Drops 'count' elements from the back, O(1) for trivially destructible types: **/
+        void pop_back(const size_type count)
+        {
+            right -= count;
+            std::destroy_n(data + right, count);
+        }
+
+        /** Drops 'count' elements from the front, O(1) for trivially destructible types: **/
+        void pop_front(const size_type count)
+        {
+            std::destroy_n(data + left + 1, count);
+            left += count;
+        }
+
+        /** Changes the size adding value-initialized elements to (or removing them from) the back: **/
+        void resize_back(const size_type size)
+        {
+            if (const size_type current = Size(); size <= current) {
+                pop_back(current - size);
+            } else {
+                if (BackCapacity() < size - current)
+                    Reserve(0, grownRoom(size - current));
+                std::uninitialized_value_construct_n(data + right, size - current);
+                right += size - current;
+            }
+        }
+
+        /** Same as above, but the new elements are default-initialized (left as is for trivial types): **/
+        void resize_back(const size_type size, default_init_t)
+        {
+            if (const size_type current = Size(); size <= current) {
+                pop_back(current - size);
+            } else {
+                if (BackCapacity() < size - current)
+                    Reserve(0, grownRoom(size - current));
+                std::uninitialized_default_construct_n(data + right, size - current);
+                right += size - current;
+            }
+        }
+
+        /** Changes the size adding value-initialized elements to (or removing them from) the front: **/
+        void resize_front(const size_type size)
+        {
+            if (const size_type current = Size(); size <= current) {
+                pop_front(current - size);
+            } else {
+                if (left < size - current)
+                    Reserve(grownRoom(size - current), 0);
+                left -= size - current;
+                std::uninitialized_value_construct_n(data + left + 1, size - current);
+            }
+        }
+
+        void resize_front(const size_type size, default_init_t)
+        {
+            if (const size_type current = Size(); size <= current) {
+                pop_front(current - size);
+            } else {
+                if (left < size - current)
+                    Reserve(grownRoom(size - current), 0);
+                left -= size - current;
+                std::uninitialized_default_construct_n(data + left + 1, size - current);
+            }
+        }
+
+        /** Inserts before 'index' shifting the shorter half of the elements: **/
+        object_type& insert(const size_type index, object_type value)
+        {
+            const size_type size = Size();
+            if (index >= size)
+                return push_back(std::move(value));
+            if (0 == index)
+                return push_front(std::move(value));
+
+            if (index < size / 2)
+            {
+                object_type first { std::move(data[left + 1]) };
+                push_front(std::move(first));
+                std::move(begin() + 2, begin() + index + 1, begin() + 1);
+            }
+            else
+            {
+                object_type last { std::move(data[right - 1]) };
+                push_back(std::move(last));
+                std::move_backward(begin() + index, end() - 2, end() - 1);
+            }
+            return begin()[index] = std::move(value);
+        }
+
+        /** Erases the element at 'index' shifting the shorter half of the elements: **/
+        void erase(const size_type index)
+        {
+            if (index < Size() / 2) {
+                std::move_backward(begin(), begin() + index, begin() + index + 1);
+                pop_front();
+            } else {
+                std::move(begin() + index + 1, end(), begin() + index);
+                pop_back();
+            }
+        }
+
         template<typename ... Args>
         object_type& emplace_back(Args&&... params)
         {
@@ -275,7 +664,7 @@ namespace DVector
             return data[left--];
         }
 
-        void swap(DVector<object_type, Allocator> &other) noexcept
+        void swap(DVector &other) noexcept
         {
             std::swap(this->data, other.data);
             std::swap(this->left, other.left);
@@ -283,8 +672,8 @@ namespace DVector
             std::swap(this->capacity, other.capacity);
         }
 
-        static void swap(DVector<object_type, Allocator> &first,
-                         DVector<object_type, Allocator> &second) noexcept
+        static void swap(DVector &first,
+                         DVector &second) noexcept
         {
             std::swap(first.data, second.data);
             std::swap(first.left, second.left);
@@ -309,6 +698,285 @@ namespace DVector
             growVector();
         }
     };
+
+    /** Bit-packed DVector<bool>. Bits are stored in the two-sided DVector of 64 bit words, so both
+     *  push_front() and push_back() stay O(1). The bits outside of the elements are always zero.
+     *  'SizeType' indexes the words, the bit counts are always size_t. **/
+    template<typename Allocator, std::unsigned_integral SizeType>
+    class DVector<bool, Allocator, SizeType>
+    {
+        using word_type = uint64_t;
+        using size_type = size_t;
+        using word_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<word_type>;
+
+        static constexpr size_type wordBits { std::numeric_limits<word_type>::digits };
+
+    private:
+        /** Words holding the bits: **/
+        DVector<word_type, word_allocator, SizeType> words;
+
+        /** Bit index of the first element inside the first word: **/
+        size_type offset { 0 };
+
+        /** Number of the bits stored: **/
+        size_type size { 0 };
+
+    public:
+
+        /** Proxy to the single bit: **/
+        class reference
+        {
+            friend class DVector;
+
+            word_type* word { nullptr };
+            word_type mask { 0 };
+
+            reference(word_type* w, word_type m) noexcept: word { w }, mask { m } {
+            }
+
+        public:
+
+            operator bool() const noexcept {
+                return 0 != (*word & mask);
+            }
+
+            reference& operator=(bool value) noexcept
+            {
+                if (value)
+                    *word |= mask;
+                else
+                    *word &= ~mask;
+                return *this;
+            }
+
+            reference& operator=(const reference& other) noexcept {
+                return *this = static_cast<bool>(other);
+            }
+
+            void flip() noexcept {
+                *word ^= mask;
+            }
+        };
+
+    private:
+
+        [[nodiscard]]
+        reference bitAt(size_type index) const noexcept
+        {
+            const size_type position = offset + index;
+            return reference { &words[position / wordBits], word_type { 1 } << (position % wordBits) };
+        }
+
+        /** Returns 'wordBits' bits starting at the logical index 'position' (which may be negative): **/
+        [[nodiscard]]
+        word_type extract(std::ptrdiff_t position) const noexcept
+        {
+            const std::ptrdiff_t physical = position + static_cast<std::ptrdiff_t>(offset);
+            if (physical < 0)
+                return words[0] << -physical;
+
+            const size_type index = static_cast<size_type>(physical) / wordBits;
+            const size_type shift = static_cast<size_type>(physical) % wordBits;
+            if (index >= words.Size())
+                return 0;
+            if (0 == shift)
+                return words[index];
+
+            const word_type high = index + 1 < words.Size() ? words[index + 1] << (wordBits - shift) : 0;
+            return (words[index] >> shift) | high;
+        }
+
+        template<typename Operation>
+        void combine(const DVector& other, Operation operation)
+        {
+            if (other.size != size)
+                throw std::invalid_argument(std::format("{} bits can not be combined with {} bits", size, other.size));
+
+            for (size_type idx = 0; idx < words.Size(); ++idx) {
+                const std::ptrdiff_t position = static_cast<std::ptrdiff_t>(idx * wordBits) - static_cast<std::ptrdiff_t>(offset);
+                words[idx] = operation(words[idx], other.extract(position));
+            }
+            clearPadding();
+        }
+
+        void clearPadding() noexcept
+        {
+            if (words.Empty())
+                return;
+            words.Front() &= ~word_type { 0 } << offset;
+            if (const size_type tail = (offset + size) % wordBits; 0 != tail)
+                words.Back() &= (word_type { 1 } << tail) - 1;
+        }
+
+    public:
+
+        explicit DVector(const size_type bits = 0):
+                words (bits / wordBits + 1) {
+        }
+
+        [[nodiscard]]
+        reference operator[] (size_type index) noexcept {
+            return bitAt(index);
+        }
+
+        [[nodiscard]]
+        bool operator[] (size_type index) const noexcept {
+            return bitAt(index);
+        }
+
+        [[nodiscard]]
+        bool at(size_type index) const {
+            if (index >= size)
+                throw std::out_of_range(std::format("{} index is out of range", index));
+            return bitAt(index);
+        }
+
+        [[nodiscard]]
+        bool Front() const noexcept {
+            return bitAt(0);
+        }
+
+        [[nodiscard]]
+        bool Back() const noexcept {
+            return bitAt(size - 1);
+        }
+
+        [[nodiscard]]
+        inline size_type Size() const noexcept {
+            return size;
+        }
+
+        [[nodiscard]]
+        inline size_type Capacity() const noexcept {
+            return words.Capacity() * wordBits;
+        }
+
+        [[nodiscard]]
+        inline bool Empty() const noexcept {
+            return 0 == size;
+        }
+
+        /** Underlying words, the first element is the bit 'FirstBitOffset()' of the first word: **/
+        [[nodiscard]]
+        inline const DVector<word_type, word_allocator, SizeType>& Words() const noexcept {
+            return words;
+        }
+
+        [[nodiscard]]
+        inline size_type FirstBitOffset() const noexcept {
+            return offset;
+        }
+
+        void Clear() noexcept
+        {
+            words.Clear();
+            offset = 0;
+            size = 0;
+        }
+
+        void push_back(bool value)
+        {
+            const size_type position = offset + size;
+            if (position == words.Size() * wordBits)
+                words.push_back(0);
+            if (value)
+                words.Back() |= word_type { 1 } << (position % wordBits);
+            ++size;
+        }
+
+        void push_front(bool value)
+        {
+            if (0 == offset) {
+                words.push_front(0);
+                offset = wordBits;
+            }
+            --offset;
+            if (value)
+                words.Front() |= word_type { 1 } << offset;
+            ++size;
+        }
+
+        void pop_back()
+        {
+            bitAt(size - 1) = false;
+            if (0 == --size)
+                return Clear();
+            if (0 == (offset + size) % wordBits)
+                words.pop_back();
+        }
+
+        void pop_front()
+        {
+            bitAt(0) = false;
+            if (0 == --size)
+                return Clear();
+            if (wordBits == ++offset) {
+                words.pop_front();
+                offset = 0;
+            }
+        }
+
+        /** Number of the bits set: **/
+        [[nodiscard]]
+        size_type PopCount() const noexcept
+        {
+            size_type count = 0;
+            for (const word_type word: words)
+                count += static_cast<size_type>(std::popcount(word));
+            return count;
+        }
+
+        /** 64 bits starting at 'index' (the bit 'index' is the lowest one), zeros past the end: **/
+        [[nodiscard]]
+        word_type BitsAt(size_type index) const noexcept {
+            return extract(static_cast<std::ptrdiff_t>(index));
+        }
+
+        /** Index of the first bit set, Size() if there is none: **/
+        [[nodiscard]]
+        size_type FindFirstSet() const noexcept
+        {
+            for (size_type idx = 0; idx < words.Size(); ++idx)
+                if (0 != words[idx])
+                    return idx * wordBits + static_cast<size_type>(std::countr_zero(words[idx])) - offset;
+            return size;
+        }
+
+        /** Element-wise operations, both vectors must have the same size: **/
+        DVector& operator&=(const DVector& other) {
+            combine(other, std::bit_and<word_type> {});
+            return *this;
+        }
+
+        DVector& operator|=(const DVector& other) {
+            combine(other, std::bit_or<word_type> {});
+            return *this;
+        }
+
+        DVector& operator^=(const DVector& other) {
+            combine(other, std::bit_xor<word_type> {});
+            return *this;
+        }
+
+        [[nodiscard]]
+        friend DVector operator&(DVector first, const DVector& second) {
+            return first &= second;
+        }
+
+        [[nodiscard]]
+        friend DVector operator|(DVector first, const DVector& second) {
+            return first |= second;
+        }
+
+        [[nodiscard]]
+        friend DVector operator^(DVector first, const DVector& second) {
+            return first ^= second;
+        }
+    };
+
+    /** DVector with the storage and the first element aligned to 'Alignment' bytes (SIMD loads): **/
+    template<typename Type, size_t Alignment = cacheLineSize>
+    using AlignedDVector = DVector<Type, Allocator<Type, Alignment>>;
 }
 
 #endif //CPPPROJECTS_DVECTOR_H
@@ -0,0 +1,138 @@
+/**============================================================================
+Name        : DVectorIO.h
+Created on  : 19.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : File descriptor I/O straight into / from the DVector headroom
+============================================================================**/
+
+#ifndef CPPPROJECTS_DVECTORIO_H
+#define CPPPROJECTS_DVECTORIO_H
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <span>
+#include <ranges>
+#include <vector>
+#include <unistd.h>
+#include <sys/uio.h>
+#include "DVector.h"
+
+namespace DVector::IO
+{
+    /** Element types the bytes can be received into without splitting an element: **/
+    template<typename Type>
+    concept ByteLike = std::is_trivial_v<Type> && 1 == sizeof(Type);
+
+    /** Where readv() should place the bytes: up to 'count' bytes appended to the 'vector': **/
+    template<ByteLike Type, typename Allocator = Allocator<Type>>
+    struct ReadTarget
+    {
+        DVector<Type, Allocator>* vector { nullptr };
+        size_t count { 0 };
+    };
+
+    /** All functions follow the POSIX calls they wrap: the number of bytes transferred is
+     *  returned, -1 with the errno set on error. The vectors are changed only by the bytes
+     *  actually transferred. **/
+
+    /** Reads up to 'count' bytes appending them to the vector: **/
+    template<ByteLike Type, typename Allocator>
+    ssize_t read(int fd, DVector<Type, Allocator>& vector, size_t count)
+    {
+        const std::span<Type> buffer = vector.prepare_back(count);
+        const ssize_t received = ::read(fd, buffer.data(), buffer.size());
+        if (received > 0)
+            vector.commit_back(static_cast<size_t>(received));
+        return received;
+    }
+
+    /** Reads up to 'count' bytes prepending them to the vector. A short read moves the received
+     *  bytes (and only them) next to the first element: **/
+    template<ByteLike Type, typename Allocator>
+    ssize_t read_front(int fd, DVector<Type, Allocator>& vector, size_t count)
+    {
+        const std::span<Type> buffer = vector.prepare_front(count);
+        const ssize_t received = ::read(fd, buffer.data(), buffer.size());
+        if (received > 0)
+        {
+            const auto size = static_cast<size_t>(received);
+            if (size < count)
+                std::memmove(buffer.data() + (count - size), buffer.data(), size);
+            vector.commit_front(size);
+        }
+        return received;
+    }
+
+    /** Scatters one read over the back headroom of the ReadTarget range, filled in order. The same
+     *  vector may appear only once (its slices would overlap), otherwise fails with EINVAL: **/
+    template<std::ranges::random_access_range Targets>
+    ssize_t readv(int fd, const Targets& targets)
+    {
+        std::vector<const void*> owners;
+        owners.reserve(std::ranges::size(targets));
+        for (const auto& target: targets)
+            owners.push_back(target.vector);
+        std::ranges::sort(owners);
+        if (std::ranges::adjacent_find(owners) != owners.end()) {
+            errno = EINVAL;
+            return -1;
+        }
+
+        std::vector<iovec> vectors;
+        vectors.reserve(std::ranges::size(targets));
+        for (const auto& target: targets) {
+            const auto buffer = target.vector->prepare_back(target.count);
+            vectors.push_back({ buffer.data(), buffer.size() });
+        }
+
+        const ssize_t received = ::readv(fd, vectors.data(), static_cast<int>(vectors.size()));
+        for (size_t idx = 0, left = received > 0 ? static_cast<size_t>(received) : 0; left > 0; ++idx) {
+            const size_t size = std::min(left, targets[idx].count);
+            targets[idx].vector->commit_back(size);
+            left -= size;
+        }
+        return received;
+    }
+
+    /** Writes the elements, the bytes written are popped from the front: **/
+    template<ByteLike Type, typename Allocator>
+    ssize_t write(int fd, DVector<Type, Allocator>& vector)
+    {
+        const ssize_t sent = ::write(fd, vector.Data(), vector.Size());
+        if (sent > 0)
+            vector.pop_front(static_cast<size_t>(sent));
+        return sent;
+    }
+
+    /** Gathers the elements of the range of vector pointers into one write, the bytes written are popped.
+     *  The same vector may appear only once (its bytes would be sent twice), otherwise fails with EINVAL: **/
+    template<std::ranges::random_access_range Sources>
+    ssize_t writev(int fd, const Sources& sources)
+    {
+        std::vector<const void*> owners (std::ranges::begin(sources), std::ranges::end(sources));
+        std::ranges::sort(owners);
+        if (std::ranges::adjacent_find(owners) != owners.end()) {
+            errno = EINVAL;
+            return -1;
+        }
+
+        std::vector<iovec> vectors;
+        vectors.reserve(std::ranges::size(sources));
+        for (const auto& source: sources)
+            vectors.push_back({ source->Data(), source->Size() });
+
+        const ssize_t sent = ::writev(fd, vectors.data(), static_cast<int>(vectors.size()));
+        const size_t count = std::ranges::size(sources);
+        for (size_t idx = 0, left = sent > 0 ? static_cast<size_t>(sent) : 0; left > 0 && idx < count; ++idx) {
+            const size_t size = std::min(left, sources[idx]->Size());
+            sources[idx]->pop_front(size);
+            left -= size;
+        }
+        return sent;
+    }
+}
+
+#endif //CPPPROJECTS_DVECTORIO_H
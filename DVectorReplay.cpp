@@ -0,0 +1,405 @@
+/**============================================================================
+Name        : DVectorReplay.cpp
+Created on  : 19.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Replays the DVector trace against the growth policies and backends
+============================================================================**/
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <format>
+#include <chrono>
+#include <deque>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <optional>
+#include <functional>
+#include <algorithm>
+#include <array>
+
+#include "DVector.h"
+#include "DVectorTrace.h"
+#include "RecyclingAllocator.h"
+
+namespace
+{
+    using DVector::Trace::Operation;
+    using DVector::Trace::Record;
+
+    struct Metrics
+    {
+        std::optional<double> milliseconds;
+        size_t peakBytes { 0 };
+        size_t allocations { 0 };
+        size_t bytesMoved { 0 };
+    };
+
+    struct MemoryCounter
+    {
+        static inline size_t current { 0 };
+        static inline size_t peak { 0 };
+        static inline size_t allocations { 0 };
+
+        static void reset() noexcept {
+            current = peak = allocations = 0;
+        }
+    };
+
+    /** Counts the allocations and the live bytes of the real backends: **/
+    template<typename Upstream>
+    struct CountingAllocator: Upstream
+    {
+        using value_type = typename Upstream::value_type;
+
+        template<typename Other>
+        struct rebind {
+            using other = CountingAllocator<typename std::allocator_traits<Upstream>::template rebind_alloc<Other>>;
+        };
+
+        CountingAllocator() = default;
+
+        template<typename Other>
+        CountingAllocator(const CountingAllocator<Other>&) noexcept {
+        }
+
+        value_type* allocate(size_t size)
+        {
+            ++MemoryCounter::allocations;
+            MemoryCounter::current += size * sizeof(value_type);
+            MemoryCounter::peak = std::max(MemoryCounter::peak, MemoryCounter::current);
+            return Upstream::allocate(size);
+        }
+
+        void deallocate(value_type* ptr, size_t size)
+        {
+            MemoryCounter::current -= size * sizeof(value_type);
+            Upstream::deallocate(ptr, size);
+        }
+
+        friend bool operator==(const CountingAllocator&, const CountingAllocator&) noexcept {
+            return true;
+        }
+    };
+
+    /** Keeps the replayed element reads from being optimized away: **/
+    volatile size_t indexSink { 0 };
+
+    template<size_t Size>
+    struct Element
+    {
+        std::array<std::byte, Size> bytes {};
+    };
+
+    /** Uniform view of the containers replayed. The operations return the number of the elements
+     *  they shifted explicitly, 'Data()' is used to detect the relocations: **/
+    template<typename Type, typename Alloc>
+    struct DVectorBackend
+    {
+        /** The first element moves with push_front() and pop_front(): **/
+        static constexpr bool slidingFront { true };
+
+        DVector::DVector<Type, Alloc> vector;
+
+        explicit DVectorBackend(size_t capacity): vector (capacity) {}
+        size_t Size() const { return vector.Size(); }
+        const Type* Data() const { return vector.Empty() ? nullptr : vector.Data(); }
+        const Type& at(size_t index) const { return vector[index]; }
+        size_t push_back() { vector.push_back(Type {}); return 0; }
+        size_t push_front() { vector.push_front(Type {}); return 0; }
+        size_t pop_back() { vector.pop_back(); return 0; }
+        size_t pop_front() { vector.pop_front(); return 0; }
+        void Clear() { vector.Clear(); }
+    };
+
+    template<typename Type, typename Alloc>
+    struct VectorBackend
+    {
+        static constexpr bool slidingFront { false };
+
+        std::vector<Type, Alloc> vector;
+
+        explicit VectorBackend(size_t capacity) { vector.reserve(capacity); }
+        size_t Size() const { return vector.size(); }
+        const Type* Data() const { return vector.empty() ? nullptr : vector.data(); }
+        const Type& at(size_t index) const { return vector[index]; }
+        size_t push_back() { vector.push_back(Type {}); return 0; }
+        size_t push_front() { vector.insert(vector.begin(), Type {}); return vector.size() - 1; }
+        size_t pop_back() { vector.pop_back(); return 0; }
+        size_t pop_front() { vector.erase(vector.begin()); return vector.size(); }
+        void Clear() { vector.clear(); }
+    };
+
+    template<typename Type, typename Alloc>
+    struct DequeBackend
+    {
+        static constexpr bool slidingFront { false };
+
+        std::deque<Type, Alloc> deque;
+
+        explicit DequeBackend(size_t) {}
+        size_t Size() const { return deque.size(); }
+        const Type* Data() const { return nullptr; }
+        const Type& at(size_t index) const { return deque[index]; }
+        size_t push_back() { deque.push_back(Type {}); return 0; }
+        size_t push_front() { deque.push_front(Type {}); return 0; }
+        size_t pop_back() { deque.pop_back(); return 0; }
+        size_t pop_front() { deque.pop_front(); return 0; }
+        void Clear() { deque.clear(); }
+    };
+
+    template<typename Backend, typename Type>
+    Metrics replay(const std::vector<Record>& records, size_t defaultCapacity)
+    {
+        MemoryCounter::reset();
+        Metrics metrics;
+        size_t checksum = 0;
+        {
+            std::vector<std::optional<Backend>> instances;
+            const auto started = std::chrono::steady_clock::now();
+            for (const Record& record: records)
+            {
+                if (record.instance >= instances.size())
+                    instances.resize(record.instance + 1);
+                std::optional<Backend>& backend = instances[record.instance];
+                if (Operation::Create == record.operation) {
+                    backend.emplace(0 != record.argument ? record.argument : defaultCapacity);
+                    continue;
+                }
+                if (!backend)
+                    continue;
+
+                const size_t size = backend->Size();
+                const Type* expected = backend->Data();
+                size_t shifted = 0;
+                switch (record.operation)
+                {
+                    case Operation::PushBack:
+                        shifted = backend->push_back();
+                        break;
+                    case Operation::PushFront:
+                        shifted = backend->push_front();
+                        if (Backend::slidingFront && nullptr != expected)
+                            --expected;
+                        break;
+                    case Operation::PopBack:
+                        if (0 != size)
+                            shifted = backend->pop_back();
+                        break;
+                    case Operation::PopFront:
+                        if (0 != size)
+                            shifted = backend->pop_front();
+                        if (Backend::slidingFront && nullptr != expected)
+                            ++expected;
+                        break;
+                    case Operation::Clear:
+                        backend->Clear();
+                        break;
+                    case Operation::Index:
+                        if (record.argument < size)
+                            checksum += std::to_integer<size_t>(backend->at(record.argument).bytes[0]);
+                        break;
+                    case Operation::Destroy:
+                        backend.reset();
+                        continue;
+                    default:
+                        break;
+                }
+                metrics.bytesMoved += shifted * sizeof(Type);
+
+                /** The elements kept have been relocated (reallocation or re-centering): **/
+                if (const Type* data = backend->Data(); nullptr != expected && nullptr != data && expected != data)
+                    metrics.bytesMoved += std::min(size, backend->Size()) * sizeof(Type);
+            }
+            metrics.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started).count();
+        }
+
+        indexSink = checksum;
+        metrics.peakBytes = MemoryCounter::peak;
+        metrics.allocations = MemoryCounter::allocations;
+        return metrics;
+    }
+
+    /** Index arithmetic of DVector with the configurable policy, no element is stored: **/
+    struct GrowthModel
+    {
+        size_t capacity { 0 };
+        size_t left { 0 };
+        size_t right { 0 };
+    };
+
+    Metrics simulate(const std::vector<Record>& records, size_t elementSize, size_t initialCapacity, size_t growthFactor)
+    {
+        Metrics metrics;
+        size_t current = 0;
+        std::vector<std::optional<GrowthModel>> instances;
+
+        const auto grow = [&](GrowthModel& model)
+        {
+            const size_t size = model.right - model.left - 1;
+            metrics.bytesMoved += size * elementSize;
+            if (model.right - model.left < model.capacity / 2) {
+                model.left = (model.capacity - size - 1) / 2;
+                model.right = model.left + size + 1;
+                return;
+            }
+
+            const size_t leftCenterDistance = model.capacity / 2 - model.left - 1;
+            const size_t newCapacity = model.capacity * growthFactor;
+            ++metrics.allocations;
+            metrics.peakBytes = std::max(metrics.peakBytes, current + newCapacity * elementSize);
+            current += (newCapacity - model.capacity) * elementSize;
+
+            model.left = newCapacity / 2 - leftCenterDistance - 1;
+            model.right = model.left + size + 1;
+            model.capacity = newCapacity;
+        };
+
+        for (const Record& record: records)
+        {
+            if (record.instance >= instances.size())
+                instances.resize(record.instance + 1);
+            std::optional<GrowthModel>& model = instances[record.instance];
+            if (Operation::Create == record.operation)
+            {
+                const size_t capacity = std::max<size_t>(0 != record.argument ? record.argument : initialCapacity, 2);
+                model = GrowthModel { capacity, capacity / 2 - 1, capacity / 2 };
+                ++metrics.allocations;
+                current += capacity * elementSize;
+                metrics.peakBytes = std::max(metrics.peakBytes, current);
+                continue;
+            }
+            if (!model)
+                continue;
+
+            switch (record.operation)
+            {
+                case Operation::PushBack:
+                    if (model->right >= model->capacity)
+                        grow(*model);
+                    ++model->right;
+                    break;
+                case Operation::PushFront:
+                    if (0 == model->left)
+                        grow(*model);
+                    --model->left;
+                    break;
+                case Operation::PopBack:
+                    if (model->right - model->left > 1)
+                        --model->right;
+                    break;
+                case Operation::PopFront:
+                    if (model->right - model->left > 1)
+                        ++model->left;
+                    break;
+                case Operation::Clear:
+                    model->left = model->capacity / 2 - 1;
+                    model->right = model->left + 1;
+                    break;
+                case Operation::Destroy:
+                    current -= model->capacity * elementSize;
+                    model.reset();
+                    break;
+                default:
+                    break;
+            }
+        }
+        return metrics;
+    }
+
+    void print(const std::string& name, const Metrics& metrics)
+    {
+        std::cout << std::left << std::setw(36) << name << std::right
+                  << std::setw(12) << (metrics.milliseconds ? std::format("{:.3f}", *metrics.milliseconds) : "-")
+                  << std::setw(14) << metrics.peakBytes
+                  << std::setw(13) << metrics.allocations
+                  << std::setw(16) << metrics.bytesMoved << '\n';
+    }
+
+    template<size_t ElementSize>
+    void replayAll(const std::vector<Record>& records)
+    {
+        using Type = Element<ElementSize>;
+        constexpr size_t defaultCapacity { 10 };
+
+        print("DVector", replay<DVectorBackend<Type, CountingAllocator<DVector::Allocator<Type>>>, Type>(records, defaultCapacity));
+        print("DVector + RecyclingAllocator",
+              replay<DVectorBackend<Type, CountingAllocator<DVector::RecyclingAllocator<Type>>>, Type>(records, defaultCapacity));
+        print("std::vector", replay<VectorBackend<Type, CountingAllocator<std::allocator<Type>>>, Type>(records, defaultCapacity));
+        print("std::deque", replay<DequeBackend<Type, CountingAllocator<std::allocator<Type>>>, Type>(records, defaultCapacity));
+    }
+
+    [[nodiscard]]
+    std::vector<size_t> parseList(const std::string& text)
+    {
+        std::vector<size_t> values;
+        std::stringstream stream { text };
+        for (std::string item; std::getline(stream, item, ',');)
+            values.push_back(std::stoul(item));
+        return values;
+    }
+
+    /** Replays with the nearest power of two element size not above 64 bytes: **/
+    void dispatch(const std::vector<Record>& records, uint32_t elementSize)
+    {
+        if (elementSize <= 1) return replayAll<1>(records);
+        if (elementSize <= 2) return replayAll<2>(records);
+        if (elementSize <= 4) return replayAll<4>(records);
+        if (elementSize <= 8) return replayAll<8>(records);
+        if (elementSize <= 16) return replayAll<16>(records);
+        if (elementSize <= 32) return replayAll<32>(records);
+        return replayAll<64>(records);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <trace> [--initial 10,64] [--factor 2,4,8]\n";
+        return 1;
+    }
+
+    std::vector<size_t> initialCapacities { 10, 64 }, growthFactors { 2, 4, 8 };
+    for (int idx = 2; idx + 1 < argc; idx += 2)
+    {
+        const std::string option { argv[idx] };
+        if ("--initial" == option)
+            initialCapacities = parseList(argv[idx + 1]);
+        else if ("--factor" == option)
+            growthFactors = parseList(argv[idx + 1]);
+    }
+
+    try
+    {
+        std::ifstream file { argv[1], std::ios::binary };
+        if (!file) {
+            std::cerr << "Can not open " << argv[1] << '\n';
+            return 1;
+        }
+
+        DVector::Trace::Reader reader { file };
+        std::vector<Record> records;
+        while (const std::optional<Record> record = reader.next())
+            records.push_back(*record);
+
+        std::cout << records.size() << " records, element size " << reader.ElementSize() << " bytes\n\n"
+                  << std::left << std::setw(36) << "backend / policy" << std::right << std::setw(12) << "time, ms"
+                  << std::setw(14) << "peak bytes" << std::setw(13) << "allocations" << std::setw(16) << "bytes moved" << '\n';
+
+        dispatch(records, reader.ElementSize());
+        for (const size_t initial: initialCapacities)
+            for (const size_t factor: growthFactors)
+                if (factor > 1)
+                    print(std::format("model: initial {}, factor {}", initial, factor),
+                          simulate(records, reader.ElementSize(), initial, factor));
+    }
+    catch (const std::exception& exc)
+    {
+        std::cerr << exc.what() << '\n';
+        return 1;
+    }
+    return 0;
+}
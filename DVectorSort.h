@@ -0,0 +1,185 @@
+/**============================================================================
+Name        : DVectorSort.h
+Created on  : 19.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : LSD radix sort for the numeric keys and parallel comparison sort
+============================================================================**/
+
+#ifndef CPPPROJECTS_DVECTORSORT_H
+#define CPPPROJECTS_DVECTORSORT_H
+
+#include <array>
+#include <bit>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include "DVector.h"
+
+namespace DVector
+{
+    /** Keys the radix sort orders by their bits: integers and float / double: **/
+    template<typename Key>
+    concept RadixKey = sizeof(Key) <= sizeof(uint64_t) &&
+            ((std::integral<Key> && !std::same_as<Key, bool>) || std::floating_point<Key>);
+
+    namespace Sorting
+    {
+        /** Below this size std::sort wins over both the radix passes and the threads: **/
+        inline constexpr size_t radixThreshold { 256 };
+        inline constexpr size_t parallelThreshold { 1 << 16 };
+
+        template<typename Key>
+        using bits_type = std::conditional_t<sizeof(Key) == 1, uint8_t,
+                          std::conditional_t<sizeof(Key) == 2, uint16_t,
+                          std::conditional_t<sizeof(Key) == 4, uint32_t, uint64_t>>>;
+
+        /** Maps the key to the unsigned bits with the same order: the sign bit is flipped for the
+         *  signed integers, all the bits of the negative floats are inverted: **/
+        template<RadixKey Key>
+        [[nodiscard]]
+        constexpr bits_type<Key> orderedBits(const Key key) noexcept
+        {
+            using Bits = bits_type<Key>;
+            constexpr Bits sign = Bits { 1 } << (std::numeric_limits<Bits>::digits - 1);
+            if constexpr (std::floating_point<Key>) {
+                const Bits bits = std::bit_cast<Bits>(key);
+                return 0 != (bits & sign) ? static_cast<Bits>(~bits) : static_cast<Bits>(bits | sign);
+            } else if constexpr (std::is_signed_v<Key>) {
+                return static_cast<Bits>(static_cast<Bits>(key) ^ sign);
+            } else {
+                return key;
+            }
+        }
+
+        /** Stable LSD radix sort of [data, data + size) by 8 bit digits. One pass builds all the
+         *  histograms, the digits equal for all the elements are skipped. 'scratch' takes 'size'
+         *  elements, the result ends up in 'data': **/
+        template<typename Type, typename KeyExtractor>
+        void radixSort(Type* data, Type* scratch, const size_t size, KeyExtractor&& key)
+        {
+            using Key = std::remove_cvref_t<std::invoke_result_t<KeyExtractor&, const Type&>>;
+            constexpr size_t digits { sizeof(Key) };
+
+            std::array<std::array<size_t, 256>, digits> counts {};
+            for (size_t idx = 0; idx < size; ++idx) {
+                const auto bits = orderedBits(key(data[idx]));
+                for (size_t digit = 0; digit < digits; ++digit)
+                    ++counts[digit][(bits >> (8 * digit)) & 0xFF];
+            }
+
+            Type* source = data;
+            Type* target = scratch;
+            const auto firstBits = orderedBits(key(data[0]));
+            for (size_t digit = 0; digit < digits; ++digit)
+            {
+                std::array<size_t, 256>& offsets = counts[digit];
+                if (size == offsets[(firstBits >> (8 * digit)) & 0xFF])
+                    continue;
+
+                size_t total = 0;
+                for (size_t& count: offsets)
+                    total += std::exchange(count, total);
+
+                for (size_t idx = 0; idx < size; ++idx) {
+                    const size_t bucket = (orderedBits(key(source[idx])) >> (8 * digit)) & 0xFF;
+                    std::memcpy(target + offsets[bucket]++, source + idx, sizeof(Type));
+                }
+                std::swap(source, target);
+            }
+
+            if (source != data)
+                std::memcpy(data, source, size * sizeof(Type));
+        }
+
+        /** Sorts the chunks in the threads, then merges the neighbours pairwise, also in parallel: **/
+        template<typename Type, typename Compare>
+        void parallelSort(Type* first, Type* last, Compare compare,
+                          const size_t maxThreads = std::thread::hardware_concurrency())
+        {
+            const size_t size = last - first;
+            const size_t threads = std::min<size_t>(std::max<size_t>(1, maxThreads), size / parallelThreshold);
+            if (threads < 2)
+                return std::sort(first, last, compare);
+
+            std::vector<Type*> bounds;
+            for (size_t idx = 0; idx <= threads; ++idx)
+                bounds.push_back(first + size * idx / threads);
+
+            const auto runAll = [](std::vector<std::thread>& workers) {
+                for (std::thread& worker: workers)
+                    worker.join();
+                workers.clear();
+            };
+
+            std::vector<std::thread> workers;
+            for (size_t idx = 0; idx < threads; ++idx)
+                workers.emplace_back([&bounds, &compare, idx] { std::sort(bounds[idx], bounds[idx + 1], compare); });
+            runAll(workers);
+
+            for (size_t width = 1; width < threads; width *= 2)
+            {
+                for (size_t idx = 0; idx + width < threads; idx += 2 * width) {
+                    Type* middle = bounds[idx + width];
+                    Type* end = bounds[std::min(idx + 2 * width, threads)];
+                    workers.emplace_back([&bounds, &compare, idx, middle, end] {
+                        std::inplace_merge(bounds[idx], middle, end, compare);
+                    });
+                }
+                runAll(workers);
+            }
+        }
+    }
+
+    /** Radix sort by the numeric key extracted from the element (a record field, for instance).
+     *  Stable. The scratch buffer is taken from the vector's own headroom when there is enough of
+     *  it on either side, otherwise one block is allocated. The elements are moved with memcpy, so
+     *  those that are not trivially copyable are sorted with std::stable_sort by the key instead: **/
+    template<typename Type, typename Allocator, std::unsigned_integral SizeType, typename KeyExtractor>
+        requires RadixKey<std::remove_cvref_t<std::invoke_result_t<KeyExtractor&, const Type&>>>
+    void sort_by_key(DVector<Type, Allocator, SizeType>& vector, KeyExtractor key)
+    {
+        const auto byKey = [&key](const Type& first, const Type& second) {
+            return Sorting::orderedBits(key(first)) < Sorting::orderedBits(key(second));
+        };
+
+        const size_t size = vector.Size();
+        if constexpr (!std::is_trivially_copyable_v<Type>) {
+            std::stable_sort(vector.begin(), vector.end(), byKey);
+        } else if (size < Sorting::radixThreshold) {
+            std::stable_sort(vector.begin(), vector.end(), byKey);
+        } else if (vector.BackCapacity() >= size) {
+            Sorting::radixSort(vector.Data(), vector.Data() + size, size, key);
+        } else if (vector.FrontCapacity() > size) {
+            Sorting::radixSort(vector.Data(), vector.Data() - size, size, key);
+        } else {
+            Allocator allocator;
+            Type* const scratch = allocator.allocate(size);
+            try {
+                Sorting::radixSort(vector.Data(), scratch, size, key);
+            } catch (...) {
+                allocator.deallocate(scratch, size);
+                throw;
+            }
+            allocator.deallocate(scratch, size);
+        }
+    }
+
+    /** Numbers are radix sorted, the other types go to the parallel comparison sort: **/
+    template<typename Type, typename Allocator, std::unsigned_integral SizeType>
+    void sort(DVector<Type, Allocator, SizeType>& vector)
+    {
+        if constexpr (RadixKey<Type>)
+            sort_by_key(vector, [](const Type value) { return value; });
+        else
+            Sorting::parallelSort(vector.begin(), vector.end(), std::less<> {});
+    }
+
+    template<typename Type, typename Allocator, std::unsigned_integral SizeType, typename Compare>
+    void sort(DVector<Type, Allocator, SizeType>& vector, Compare compare) {
+        Sorting::parallelSort(vector.begin(), vector.end(), compare);
+    }
+}
+
+#endif //CPPPROJECTS_DVECTORSORT_H
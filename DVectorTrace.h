@@ -0,0 +1,262 @@
+/**============================================================================
+Name        : DVectorTrace.h
+Created on  : 19.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Compact binary trace of the DVector operations (capture / read)
+============================================================================**/
+
+#ifndef CPPPROJECTS_DVECTORTRACE_H
+#define CPPPROJECTS_DVECTORTRACE_H
+
+#include <array>
+#include <cstdint>
+#include <format>
+#include <istream>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <stdexcept>
+#include "DVector.h"
+
+namespace DVector::Trace
+{
+    enum class Operation: uint8_t
+    {
+        /** Argument: the requested capacity, zero for the default one: **/
+        Create = 1,
+        Destroy,
+        PushBack,
+        PushFront,
+        PopBack,
+        PopFront,
+        Clear,
+        /** Argument: the index accessed: **/
+        Index
+    };
+
+    struct Record
+    {
+        Operation operation { Operation::Create };
+        uint32_t instance { 0 };
+        uint64_t argument { 0 };
+    };
+
+    /** The trace starts with the magic, the format version and the element size, followed by the
+     *  records: the operation byte, the instance id and the argument (only for Create and Index),
+     *  both LEB128 varints. Most of the records take two or three bytes. **/
+    inline constexpr std::array<char, 4> magic { 'D', 'V', 'T', 'R' };
+    inline constexpr uint8_t version { 1 };
+
+    [[nodiscard]]
+    constexpr bool hasArgument(Operation operation) noexcept {
+        return Operation::Create == operation || Operation::Index == operation;
+    }
+
+    /** Shared by all the traced vectors, writes are serialized: **/
+    class Recorder
+    {
+        std::ostream& output;
+        std::mutex mutex;
+        uint32_t lastInstance { 0 };
+
+        void writeVarint(uint64_t value)
+        {
+            for (; value >= 0x80; value >>= 7)
+                output.put(static_cast<char>((value & 0x7F) | 0x80));
+            output.put(static_cast<char>(value));
+        }
+
+    public:
+
+        Recorder(std::ostream& stream, const uint32_t elementSize): output { stream }
+        {
+            output.write(magic.data(), magic.size());
+            output.put(static_cast<char>(version));
+            writeVarint(elementSize);
+        }
+
+        Recorder(const Recorder&) = delete;
+        Recorder& operator=(const Recorder&) = delete;
+
+        /** Registers the new vector, returns its instance id: **/
+        uint32_t Create(const uint64_t capacity)
+        {
+            std::lock_guard lock { mutex };
+            const uint32_t instance = ++lastInstance;
+            output.put(static_cast<char>(Operation::Create));
+            writeVarint(instance);
+            writeVarint(capacity);
+            return instance;
+        }
+
+        void record(const Operation operation, const uint32_t instance, const uint64_t argument = 0)
+        {
+            std::lock_guard lock { mutex };
+            output.put(static_cast<char>(operation));
+            writeVarint(instance);
+            if (hasArgument(operation))
+                writeVarint(argument);
+        }
+    };
+
+    class Reader
+    {
+        std::istream& input;
+        uint32_t elementSize { 0 };
+
+        [[nodiscard]]
+        std::optional<uint64_t> readVarint()
+        {
+            uint64_t value = 0;
+            for (uint32_t shift = 0; shift < 64; shift += 7)
+            {
+                const int byte = input.get();
+                if (std::istream::traits_type::eof() == byte)
+                    return std::nullopt;
+                value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                if (0 == (byte & 0x80))
+                    return value;
+            }
+            throw std::runtime_error("malformed varint in the trace");
+        }
+
+    public:
+
+        explicit Reader(std::istream& stream): input { stream }
+        {
+            std::array<char, magic.size()> header {};
+            input.read(header.data(), header.size());
+            if (header != magic || version != input.get())
+                throw std::runtime_error("not a DVector trace or unsupported version");
+            elementSize = static_cast<uint32_t>(readVarint().value_or(0));
+        }
+
+        [[nodiscard]]
+        uint32_t ElementSize() const noexcept {
+            return elementSize;
+        }
+
+        /** Next record, nothing at the end of the trace: **/
+        [[nodiscard]]
+        std::optional<Record> next()
+        {
+            const int operation = input.get();
+            if (std::istream::traits_type::eof() == operation)
+                return std::nullopt;
+
+            if (operation < static_cast<int>(Operation::Create) || operation > static_cast<int>(Operation::Index))
+                throw std::runtime_error(std::format("unknown operation {} in the trace", operation));
+
+            Record record { static_cast<Operation>(operation) };
+            const std::optional<uint64_t> instance = readVarint();
+            if (!instance)
+                throw std::runtime_error("truncated trace");
+            record.instance = static_cast<uint32_t>(*instance);
+            if (hasArgument(record.operation)) {
+                const std::optional<uint64_t> argument = readVarint();
+                if (!argument)
+                    throw std::runtime_error("truncated trace");
+                record.argument = *argument;
+            }
+            return record;
+        }
+    };
+
+    /** Opt-in capture: a DVector recording every operation to the Recorder. Elements are not
+     *  recorded, only the shape of the workload: **/
+    template<typename Type,
+            typename Allocator = Allocator<Type>>
+    class TracedDVector
+    {
+        using object_type = Type;
+        using size_type = size_t;
+
+    private:
+        DVector<object_type, Allocator> storage;
+        Recorder* recorder { nullptr };
+        uint32_t instance { 0 };
+
+    public:
+
+        /** The requested capacity is recorded, zero stands for the default one: **/
+        explicit TracedDVector(Recorder& traceRecorder, const size_type capacity = 0):
+                storage (capacity), recorder { &traceRecorder }, instance { traceRecorder.Create(capacity) } {
+        }
+
+        TracedDVector(const TracedDVector&) = delete;
+        TracedDVector& operator=(const TracedDVector&) = delete;
+
+        ~TracedDVector() {
+            recorder->record(Operation::Destroy, instance);
+        }
+
+        [[nodiscard]]
+        inline size_type Size() const noexcept {
+            return storage.Size();
+        }
+
+        [[nodiscard]]
+        inline bool Empty() const noexcept {
+            return storage.Empty();
+        }
+
+        /** Untraced access to the underlying vector: **/
+        [[nodiscard]]
+        inline const DVector<object_type, Allocator>& Storage() const noexcept {
+            return storage;
+        }
+
+        [[nodiscard]]
+        object_type& operator[] (size_type index)
+        {
+            recorder->record(Operation::Index, instance, index);
+            return storage[index];
+        }
+
+        object_type& push_back(const object_type& v)
+        {
+            recorder->record(Operation::PushBack, instance);
+            return storage.push_back(v);
+        }
+
+        object_type& push_back(object_type&& v)
+        {
+            recorder->record(Operation::PushBack, instance);
+            return storage.push_back(std::move(v));
+        }
+
+        object_type& push_front(const object_type& v)
+        {
+            recorder->record(Operation::PushFront, instance);
+            return storage.push_front(v);
+        }
+
+        object_type& push_front(object_type&& v)
+        {
+            recorder->record(Operation::PushFront, instance);
+            return storage.push_front(std::move(v));
+        }
+
+        void pop_back()
+        {
+            recorder->record(Operation::PopBack, instance);
+            storage.pop_back();
+        }
+
+        void pop_front()
+        {
+            recorder->record(Operation::PopFront, instance);
+            storage.pop_front();
+        }
+
+        void Clear()
+        {
+            recorder->record(Operation::Clear, instance);
+            storage.Clear();
+        }
+    };
+}
+
+#endif //CPPPROJECTS_DVECTORTRACE_H
@@ -0,0 +1,307 @@
+/**============================================================================
+Name        : FlatMap.h
+Created on  : 19.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Sorted FlatSet / FlatMap adapters on top of DVector
+============================================================================**/
+
+#ifndef CPPPROJECTS_FLATMAP_H
+#define CPPPROJECTS_FLATMAP_H
+
+#include <functional>
+#include <utility>
+#include <ranges>
+#include "DVector.h"
+
+namespace DVector
+{
+    /** Sorted unique elements stored contiguously. Keys arriving at either end are O(1) pushes,
+     *  the others are placed with the binary search shifting the shorter half of the storage. **/
+    template<typename Value, typename KeyOf, typename Compare>
+    class SortedDVector
+    {
+    protected:
+        using value_type = Value;
+        using key_type = std::remove_cvref_t<std::invoke_result_t<KeyOf, const Value&>>;
+        using size_type = size_t;
+
+        DVector<value_type> storage;
+
+        [[no_unique_address]] Compare compare {};
+        [[no_unique_address]] KeyOf keyOf {};
+
+    protected:
+
+        [[nodiscard]]
+        size_type lowerBound(const key_type& key) const
+        {
+            const value_type* position = std::lower_bound(storage.begin(), storage.end(), key,
+                [this](const value_type& value, const key_type& k) { return compare(keyOf(value), k); });
+            return static_cast<size_type>(position - storage.begin());
+        }
+
+        [[nodiscard]]
+        bool equals(const value_type& value, const key_type& key) const {
+            return !compare(keyOf(value), key) && !compare(key, keyOf(value));
+        }
+
+        /** Returns the index of the element with the key (or where it belongs) and whether it is there: **/
+        [[nodiscard]]
+        std::pair<size_type, bool> locate(const key_type& key) const
+        {
+            if (storage.Empty() || compare(keyOf(storage.Back()), key))
+                return { storage.Size(), false };
+            if (compare(key, keyOf(storage.Front())))
+                return { 0, false };
+
+            const size_type index = lowerBound(key);
+            return { index, equals(storage[index], key) };
+        }
+
+        /** Places the value at the index returned by locate(), the ends are O(1) pushes: **/
+        void insertAt(const size_type index, value_type&& value)
+        {
+            if (index == storage.Size())
+                storage.push_back(std::move(value));
+            else if (0 == index)
+                storage.push_front(std::move(value));
+            else
+                storage.insert(index, std::move(value));
+        }
+
+        /** Returns the index of the element with the key and whether it has been inserted: **/
+        std::pair<size_type, bool> insertValue(value_type&& value)
+        {
+            const auto [index, found] = locate(keyOf(value));
+            if (!found)
+                insertAt(index, std::move(value));
+            return { index, !found };
+        }
+
+    public:
+
+        explicit SortedDVector(const size_type capacity = 0): storage (capacity) {
+        }
+
+        [[nodiscard]]
+        inline size_type Size() const noexcept {
+            return storage.Size();
+        }
+
+        [[nodiscard]]
+        inline bool Empty() const noexcept {
+            return storage.Empty();
+        }
+
+        [[nodiscard]]
+        inline const value_type& operator[] (size_type index) const {
+            return storage[index];
+        }
+
+        [[nodiscard]]
+        inline const value_type* begin() const noexcept {
+            return storage.begin();
+        }
+
+        [[nodiscard]]
+        inline const value_type* end() const noexcept {
+            return storage.end();
+        }
+
+        [[nodiscard]]
+        bool contains(const key_type& key) const
+        {
+            const size_type index = lowerBound(key);
+            return index < storage.Size() && equals(storage[index], key);
+        }
+
+        /** Index of the first element not less than the key: **/
+        [[nodiscard]]
+        size_type lower_bound(const key_type& key) const {
+            return lowerBound(key);
+        }
+
+        bool erase(const key_type& key)
+        {
+            const size_type index = lowerBound(key);
+            if (index >= storage.Size() || !equals(storage[index], key))
+                return false;
+            storage.erase(index);
+            return true;
+        }
+
+        void Clear() noexcept {
+            storage.Clear();
+        }
+
+        /** Merges the range sorted by the same order. Ranges entirely before or after the current
+         *  elements are pushed to the ends, the others are merged in one linear pass: **/
+        template<std::ranges::input_range Range>
+        void merge(Range&& sorted)
+        {
+            auto it = std::ranges::begin(sorted);
+            const auto last = std::ranges::end(sorted);
+            if (it == last)
+                return;
+
+            if (storage.Empty() || compare(keyOf(storage.Back()), keyOf(*it))) {
+                for (; it != last; ++it)
+                    if (storage.Empty() || compare(keyOf(storage.Back()), keyOf(*it)))
+                        storage.push_back(*it);
+                return;
+            }
+
+            DVector<value_type> merged (2 * storage.Size() + 1);
+            const auto append = [&](auto&& value) {
+                if (merged.Empty() || compare(keyOf(merged.Back()), keyOf(value)))
+                    merged.push_back(std::forward<decltype(value)>(value));
+            };
+
+            /** The leading part before the current elements, pushed to the front if it is all: **/
+            for (; it != last && compare(keyOf(*it), keyOf(storage.Front())); ++it)
+                append(*it);
+            if (it == last) {
+                storage.prepend_from(std::ranges::subrange(std::make_move_iterator(merged.begin()),
+                                                           std::make_move_iterator(merged.end())));
+                return;
+            }
+
+            size_type index = 0;
+            while (index < storage.Size() && it != last)
+            {
+                if (compare(keyOf(*it), keyOf(storage[index]))) {
+                    append(*it);
+                    ++it;
+                } else {
+                    append(std::move(storage[index++]));
+                }
+            }
+            for (; index < storage.Size(); ++index)
+                append(std::move(storage[index]));
+            for (; it != last; ++it)
+                append(*it);
+
+            storage.swap(merged);
+        }
+    };
+
+    namespace Detail
+    {
+        struct Identity
+        {
+            template<typename T>
+            const T& operator()(const T& value) const noexcept {
+                return value;
+            }
+        };
+
+        struct PairKey
+        {
+            template<typename K, typename V>
+            const K& operator()(const std::pair<K, V>& value) const noexcept {
+                return value.first;
+            }
+        };
+    }
+
+    template<typename Key,
+             typename Compare = std::less<Key>>
+    class FlatSet: public SortedDVector<Key, Detail::Identity, Compare>
+    {
+        using base = SortedDVector<Key, Detail::Identity, Compare>;
+
+    public:
+
+        using base::base;
+
+        bool insert(Key key) {
+            return base::insertValue(std::move(key)).second;
+        }
+
+        [[nodiscard]]
+        const Key* find(const Key& key) const
+        {
+            const size_t index = base::lowerBound(key);
+            return index < base::storage.Size() && base::equals(base::storage[index], key) ?
+                   &base::storage[index] : nullptr;
+        }
+    };
+
+    template<typename Key,
+             typename Value,
+             typename Compare = std::less<Key>>
+    class FlatMap: public SortedDVector<std::pair<Key, Value>, Detail::PairKey, Compare>
+    {
+        using base = SortedDVector<std::pair<Key, Value>, Detail::PairKey, Compare>;
+
+    private:
+
+        [[nodiscard]]
+        Value* findValue(const Key& key) const
+        {
+            const size_t index = base::lowerBound(key);
+            return index < base::storage.Size() && base::equals(base::storage[index], key) ?
+                   &base::storage[index].second : nullptr;
+        }
+
+        [[nodiscard]]
+        Value& atValue(const Key& key) const
+        {
+            if (Value* value = findValue(key))
+                return *value;
+            throw std::out_of_range("key is not found");
+        }
+
+    public:
+
+        using base::base;
+
+        bool insert(Key key, Value value) {
+            return base::insertValue({ std::move(key), std::move(value) }).second;
+        }
+
+        /** Inserts or replaces the value, returns true when the key is new: **/
+        bool insert_or_assign(Key key, Value value)
+        {
+            const auto [index, found] = base::locate(key);
+            if (found)
+                base::storage[index].second = std::move(value);
+            else
+                base::insertAt(index, { std::move(key), std::move(value) });
+            return !found;
+        }
+
+        /** The key is copied and the value constructed only when the key is new: **/
+        Value& operator[] (const Key& key)
+        {
+            const auto [index, found] = base::locate(key);
+            if (!found)
+                base::insertAt(index, { key, Value {} });
+            return base::storage[index].second;
+        }
+
+        [[nodiscard]]
+        Value* find(const Key& key) {
+            return findValue(key);
+        }
+
+        [[nodiscard]]
+        const Value* find(const Key& key) const {
+            return findValue(key);
+        }
+
+        [[nodiscard]]
+        Value& at(const Key& key) {
+            return atValue(key);
+        }
+
+        [[nodiscard]]
+        const Value& at(const Key& key) const {
+            return atValue(key);
+        }
+    };
+}
+
+#endif //CPPPROJECTS_FLATMAP_H
@@ -0,0 +1,143 @@
+/**============================================================================
+Name        : FrameBuilder.h
+Created on  : 19.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Packet / frame builder prepending headers into the DVector headroom
+============================================================================**/
+
+#ifndef CPPPROJECTS_FRAMEBUILDER_H
+#define CPPPROJECTS_FRAMEBUILDER_H
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include "DVector.h"
+
+namespace DVector
+{
+    /** The payload is written first, then every protocol layer prepends its header (length, checksum,
+     *  tags) into the front headroom with a single copy of the header bytes. The payload is never moved
+     *  as long as the headers fit into the headroom reserved up front, so the nested encapsulation
+     *  costs only the header bytes. **/
+    class FrameBuilder
+    {
+        using size_type = size_t;
+
+        /** LEB128 of the 64 bit value takes at most 10 bytes: **/
+        static constexpr size_type maxVarintSize { 10 };
+
+    private:
+        DVector<std::byte> buffer;
+        size_type headroom { 0 };
+
+    private:
+
+        template<std::integral Int>
+        [[nodiscard]]
+        static std::array<std::byte, sizeof(Int)> toBigEndian(Int value) noexcept
+        {
+            auto bytes = std::bit_cast<std::array<std::byte, sizeof(Int)>>(value);
+            if constexpr (std::endian::native == std::endian::little)
+                std::ranges::reverse(bytes);
+            return bytes;
+        }
+
+        /** Returns the number of bytes written to the 'bytes': **/
+        [[nodiscard]]
+        static size_type toVarint(uint64_t value, std::array<std::byte, maxVarintSize>& bytes) noexcept
+        {
+            size_type size = 0;
+            for (; value >= 0x80; value >>= 7)
+                bytes[size++] = static_cast<std::byte>((value & 0x7F) | 0x80);
+            bytes[size++] = static_cast<std::byte>(value);
+            return size;
+        }
+
+    public:
+
+        explicit FrameBuilder(const size_type headroomBytes = 64, const size_type payloadBytes = 0):
+                headroom { headroomBytes } {
+            buffer.Reserve(headroom, payloadBytes);
+        }
+
+        [[nodiscard]]
+        inline size_type Size() const noexcept {
+            return buffer.Size();
+        }
+
+        /** Bytes which can still be prepended without moving the frame: **/
+        [[nodiscard]]
+        inline size_type Headroom() const noexcept {
+            return buffer.FrontCapacity() - 1;
+        }
+
+        /** The frame built so far, contiguous: **/
+        [[nodiscard]]
+        inline std::span<std::byte> Frame() noexcept {
+            return { buffer.Data(), buffer.Size() };
+        }
+
+        [[nodiscard]]
+        inline std::span<const std::byte> Frame() const noexcept {
+            return { buffer.Data(), buffer.Size() };
+        }
+
+        /** Starts the new frame keeping the memory and restoring the configured headroom: **/
+        void Clear()
+        {
+            buffer.Clear();
+            buffer.Reserve(headroom, 0);
+        }
+
+        void append(std::span<const std::byte> bytes)
+        {
+            std::ranges::copy(bytes, buffer.prepare_back(bytes.size()).begin());
+            buffer.commit_back(bytes.size());
+        }
+
+        template<std::integral Int>
+        void append_be(Int value) {
+            append(toBigEndian(value));
+        }
+
+        void append_varint(uint64_t value)
+        {
+            std::array<std::byte, maxVarintSize> bytes;
+            append(std::span { bytes.data(), toVarint(value, bytes) });
+        }
+
+        /** Prepends all bytes at once keeping their order: **/
+        void prepend(std::span<const std::byte> bytes)
+        {
+            std::ranges::copy(bytes, buffer.prepare_front(bytes.size()).begin());
+            buffer.commit_front(bytes.size());
+        }
+
+        template<std::integral Int>
+        void prepend_be(Int value) {
+            prepend(toBigEndian(value));
+        }
+
+        void prepend_varint(uint64_t value)
+        {
+            std::array<std::byte, maxVarintSize> bytes;
+            prepend(std::span { bytes.data(), toVarint(value, bytes) });
+        }
+
+        /** Length prefix of everything built so far: **/
+        template<std::integral Int>
+        void prepend_length_be() {
+            prepend_be(static_cast<Int>(buffer.Size()));
+        }
+
+        void prepend_length_varint() {
+            prepend_varint(buffer.Size());
+        }
+    };
+}
+
+#endif //CPPPROJECTS_FRAMEBUILDER_H
@@ -0,0 +1,167 @@
+/**============================================================================
+Name        : GapDVector.h
+Created on  : 19.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Gap buffer with the gap kept at the cursor, built of two DVectors
+============================================================================**/
+
+#ifndef CPPPROJECTS_GAPDVECTOR_H
+#define CPPPROJECTS_GAPDVECTOR_H
+
+#include <iterator>
+#include <span>
+#include "DVector.h"
+
+namespace DVector
+{
+    /** The elements before the cursor are kept in one DVector, the elements after it in another.
+     *  The back headroom of the first one and the front headroom of the second one together form
+     *  the gap, so inserting and deleting at the cursor are push / pop at their facing ends, and
+     *  moving the cursor by 'n' moves 'n' elements across. Both sides grow with the DVector policy. **/
+    template<typename Type,
+             typename Allocator = Allocator<Type>>
+    class GapDVector
+    {
+        using object_type = Type;
+        using size_type = size_t;
+
+    private:
+        /** [0, Cursor()) in order: **/
+        DVector<object_type, Allocator> before;
+
+        /** [Cursor(), Size()) in order: **/
+        DVector<object_type, Allocator> after;
+
+    public:
+
+        explicit GapDVector(const size_type capacity = 0):
+                before (capacity), after (capacity) {
+        }
+
+        [[nodiscard]]
+        inline size_type Size() const noexcept {
+            return before.Size() + after.Size();
+        }
+
+        [[nodiscard]]
+        inline bool Empty() const noexcept {
+            return before.Empty() && after.Empty();
+        }
+
+        /** Position of the gap: the number of the elements before it: **/
+        [[nodiscard]]
+        inline size_type Cursor() const noexcept {
+            return before.Size();
+        }
+
+        [[nodiscard]]
+        object_type& operator[] (size_type index) const noexcept {
+            return index < before.Size() ? before[index] : after[index - before.Size()];
+        }
+
+        [[nodiscard]]
+        object_type& at(size_type index) const
+        {
+            if (index >= Size())
+                throw std::out_of_range(std::format("{} index is out of range", index));
+            return (*this)[index];
+        }
+
+        /** Contiguous elements before and after the gap: **/
+        [[nodiscard]]
+        std::span<object_type> Before() const noexcept {
+            return { before.begin(), before.end() };
+        }
+
+        [[nodiscard]]
+        std::span<object_type> After() const noexcept {
+            return { after.begin(), after.end() };
+        }
+
+        /** Inserts at the cursor, the cursor stays after the new element (typing): **/
+        template<typename ... Args>
+        object_type& emplace(Args&&... params) {
+            return before.emplace_back(std::forward<Args>(params)...);
+        }
+
+        object_type& insert(const object_type& v) {
+            return before.push_back(v);
+        }
+
+        object_type& insert(object_type&& v) {
+            return before.push_back(std::move(v));
+        }
+
+        /** Inserts all the elements at the cursor keeping their order: **/
+        template<std::ranges::input_range Range>
+        void insert_range(Range&& range) {
+            before.append_from(std::forward<Range>(range));
+        }
+
+        /** Erases before the cursor (backspace): **/
+        void erase_before(const size_type count = 1) {
+            before.pop_back(count);
+        }
+
+        /** Erases after the cursor (delete): **/
+        void erase_after(const size_type count = 1) {
+            after.pop_front(count);
+        }
+
+        /** Moves the cursor 'count' elements back, these elements cross the gap: **/
+        void move_left(const size_type count)
+        {
+            if (count > before.Size())
+                throw std::out_of_range(std::format("can not move the cursor {} elements left from {}", count, Cursor()));
+
+            /** Geometric reservation, the exact one would reallocate on every short move: **/
+            if (after.FrontCapacity() <= count)
+                after.Reserve(std::max(count, after.Capacity()), 0);
+
+            const auto first = std::make_move_iterator(before.end() - count);
+            after.prepend_from(std::ranges::subrange(first, std::make_move_iterator(before.end())));
+            before.pop_back(count);
+        }
+
+        /** Moves the cursor 'count' elements forward: **/
+        void move_right(const size_type count)
+        {
+            if (count > after.Size())
+                throw std::out_of_range(std::format("can not move the cursor {} elements right from {}", count, Cursor()));
+
+            if (before.BackCapacity() < count)
+                before.Reserve(0, std::max(count, before.Capacity()));
+
+            const auto first = std::make_move_iterator(after.begin());
+            before.append_from(std::ranges::subrange(first, first + count));
+            after.pop_front(count);
+        }
+
+        void move_to(const size_type position)
+        {
+            if (position < Cursor())
+                move_left(Cursor() - position);
+            else if (position > Cursor())
+                move_right(position - Cursor());
+        }
+
+        void Clear() noexcept
+        {
+            before.Clear();
+            after.Clear();
+        }
+
+        template<typename Callback>
+        void forEach(Callback&& callback) const
+        {
+            for (object_type& value: before)
+                callback(value);
+            for (object_type& value: after)
+                callback(value);
+        }
+    };
+}
+
+#endif //CPPPROJECTS_GAPDVECTOR_H
@@ -0,0 +1,209 @@
+/**============================================================================
+Name        : HandleDVector.h
+Created on  : 19.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : DVector handing out stable generational handles to its elements
+============================================================================**/
+
+#ifndef CPPPROJECTS_HANDLEDVECTOR_H
+#define CPPPROJECTS_HANDLEDVECTOR_H
+
+#include <cstdint>
+#include "DVector.h"
+
+namespace DVector
+{
+    /** Compact reference to the HandleDVector element, independent of the storage address and of
+     *  the element index. The default constructed handle never resolves: **/
+    struct Handle
+    {
+        uint32_t sequence { 0 };
+        uint32_t generation { 0 };
+
+        [[nodiscard]]
+        friend bool operator==(const Handle&, const Handle&) noexcept = default;
+    };
+
+    static_assert(sizeof(Handle) == sizeof(uint64_t), "Handle should fit 64 bits");
+
+    /** Every element gets the sequence number (the next one at the back, the previous one at the
+     *  front), so the index is 'sequence - frontSequence' in the 32 bit modular arithmetic, whatever
+     *  happened to the storage. The generation table, parallel to the elements, keeps the generation
+     *  each element was pushed with: a handle to the popped element whose sequence number got reused
+     *  fails the generation check. Generations wrap after 2^32 pushes. **/
+    template<typename Type,
+            typename Allocator = Allocator<Type>>
+    class HandleDVector
+    {
+        using object_type = Type;
+        using size_type = size_t;
+        using sequence_type = uint32_t;
+        using generation_type = uint32_t;
+
+    private:
+        DVector<object_type, Allocator> storage;
+        DVector<generation_type> generations;
+
+        /** Starts in the middle, leaving the room for the push_front() numbering: **/
+        sequence_type frontSequence { sequence_type { 1 } << 31 };
+
+        /** Last generation handed out, zero is reserved for the null handle: **/
+        generation_type lastGeneration { 0 };
+
+    private:
+
+        [[nodiscard]]
+        generation_type nextGeneration() noexcept
+        {
+            if (0 == ++lastGeneration)
+                ++lastGeneration;
+            return lastGeneration;
+        }
+
+        /** Index of the element the handle refers to, Size() if it is stale: **/
+        [[nodiscard]]
+        size_type find(const Handle handle) const noexcept
+        {
+            const size_type index = static_cast<sequence_type>(handle.sequence - frontSequence);
+            if (index >= generations.Size() || generations[index] != handle.generation)
+                return storage.Size();
+            return index;
+        }
+
+    public:
+
+        explicit HandleDVector(const size_type capacity = 0):
+                storage (capacity), generations (capacity) {
+        }
+
+        [[nodiscard]]
+        inline size_type Size() const noexcept {
+            return storage.Size();
+        }
+
+        [[nodiscard]]
+        inline bool Empty() const noexcept {
+            return storage.Empty();
+        }
+
+        [[nodiscard]]
+        object_type& operator[] (size_type index) const {
+            return storage[index];
+        }
+
+        [[nodiscard]]
+        object_type& Front() const noexcept {
+            return storage.Front();
+        }
+
+        [[nodiscard]]
+        object_type& Back() const noexcept {
+            return storage.Back();
+        }
+
+        [[nodiscard]]
+        inline object_type* begin() const noexcept {
+            return storage.begin();
+        }
+
+        [[nodiscard]]
+        inline object_type* end() const noexcept {
+            return storage.end();
+        }
+
+        [[nodiscard]]
+        bool contains(const Handle handle) const noexcept {
+            return find(handle) < storage.Size();
+        }
+
+        /** O(1) lookup, nullptr for the stale handle: **/
+        [[nodiscard]]
+        object_type* get(const Handle handle) const noexcept
+        {
+            const size_type index = find(handle);
+            return index < storage.Size() ? &storage[index] : nullptr;
+        }
+
+        [[nodiscard]]
+        object_type& at(const Handle handle) const
+        {
+            const size_type index = find(handle);
+            if (index >= storage.Size())
+                throw std::out_of_range(std::format("handle ({}, {}) is stale", handle.sequence, handle.generation));
+            return storage[index];
+        }
+
+        /** Current index of the element, throws for the stale handle: **/
+        [[nodiscard]]
+        size_type IndexOf(const Handle handle) const
+        {
+            const size_type index = find(handle);
+            if (index >= storage.Size())
+                throw std::out_of_range(std::format("handle ({}, {}) is stale", handle.sequence, handle.generation));
+            return index;
+        }
+
+        [[nodiscard]]
+        Handle HandleAt(const size_type index) const noexcept {
+            return Handle { static_cast<sequence_type>(frontSequence + index), generations[index] };
+        }
+
+        template<typename ... Args>
+        Handle emplace_back(Args&&... params)
+        {
+            storage.emplace_back(std::forward<Args>(params)...);
+            generations.push_back(nextGeneration());
+            return HandleAt(storage.Size() - 1);
+        }
+
+        template<typename ... Args>
+        Handle emplace_front(Args&&... params)
+        {
+            storage.emplace_front(std::forward<Args>(params)...);
+            generations.push_front(nextGeneration());
+            --frontSequence;
+            return HandleAt(0);
+        }
+
+        Handle push_back(const object_type& v) {
+            return emplace_back(v);
+        }
+
+        Handle push_back(object_type&& v) {
+            return emplace_back(std::move(v));
+        }
+
+        Handle push_front(const object_type& v) {
+            return emplace_front(v);
+        }
+
+        Handle push_front(object_type&& v) {
+            return emplace_front(std::move(v));
+        }
+
+        void pop_back()
+        {
+            storage.pop_back();
+            generations.pop_back();
+        }
+
+        void pop_front()
+        {
+            storage.pop_front();
+            generations.pop_front();
+            ++frontSequence;
+        }
+
+        /** All handles become stale, the numbering continues: **/
+        void Clear() noexcept
+        {
+            frontSequence += static_cast<sequence_type>(storage.Size());
+            storage.Clear();
+            generations.Clear();
+        }
+    };
+}
+
+#endif //CPPPROJECTS_HANDLEDVECTOR_H
@@ -0,0 +1,234 @@
+/**============================================================================
+Name        : RecyclingAllocator.h
+Created on  : 19.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Allocator recycling the DVector buffers through thread-local free lists
+============================================================================**/
+
+#ifndef CPPPROJECTS_RECYCLINGALLOCATOR_H
+#define CPPPROJECTS_RECYCLINGALLOCATOR_H
+
+#include <array>
+#include <mutex>
+#include "DVector.h"
+
+namespace DVector
+{
+    /** Per-thread counters of one RecyclingAllocator instantiation: **/
+    struct RecyclingStats
+    {
+        /** Allocations served from the thread cache or from the shared depot: **/
+        size_t hits { 0 };
+        size_t depotHits { 0 };
+        size_t misses { 0 };
+
+        /** Buffers given back to the upstream allocator (over the limits or too large): **/
+        size_t released { 0 };
+
+        [[nodiscard]]
+        double HitRate() const noexcept {
+            return 0 == hits + misses ? 0.0 : static_cast<double>(hits) / static_cast<double>(hits + misses);
+        }
+    };
+
+    /** Opt-in allocator for the short-lived DVectors. Requests are rounded up to the capacity class
+     *  (10, 40, 160, ... matching the DVector growth) and the freed buffers are kept in the free list
+     *  of their class: first the thread-local one, up to 'MaxCached' buffers per class, then the
+     *  shared depot guarded by the mutex, up to 'MaxDepot'. The depot is also the cross-thread return
+     *  path: the buffers freed by one thread may be picked up by the others, the thread cache is moved
+     *  there once the thread exits. Capacities above the last class bypass the recycling. **/
+    template<typename _Ty,
+             size_t Alignment = alignof(_Ty),
+             size_t MaxClasses = 8,
+             size_t MaxCached = 16,
+             size_t MaxDepot = 64>
+    struct RecyclingAllocator: Allocator<_Ty, Alignment>
+    {
+        using upstream = Allocator<_Ty, Alignment>;
+
+        static constexpr size_t baseCapacity { 10 };
+        static constexpr size_t classFactor { 4 };
+
+        template<typename _Other>
+        struct rebind {
+            using other = RecyclingAllocator<_Other, std::max(Alignment, alignof(_Other)), MaxClasses, MaxCached, MaxDepot>;
+        };
+
+    private:
+
+        /** Intrusive link kept in the first bytes of the free buffer: **/
+        struct Node
+        {
+            Node* next { nullptr };
+        };
+
+        static_assert(baseCapacity * sizeof(_Ty) >= sizeof(Node), "Buffer is too small to keep the free list link");
+
+        struct FreeList
+        {
+            Node* head { nullptr };
+            size_t count { 0 };
+
+            void push(_Ty* buffer) noexcept {
+                head = ::new (static_cast<void*>(buffer)) Node { head };
+                ++count;
+            }
+
+            [[nodiscard]]
+            _Ty* pop() noexcept
+            {
+                Node* node = head;
+                head = node->next;
+                --count;
+                return reinterpret_cast<_Ty*>(node);
+            }
+        };
+
+        struct Depot
+        {
+            std::mutex mutex;
+            std::array<FreeList, MaxClasses> lists {};
+
+            ~Depot()
+            {
+                for (size_t cls = 0; cls < MaxClasses; ++cls)
+                    while (0 != lists[cls].count)
+                        upstream {}.deallocate(lists[cls].pop(), classCapacity(cls));
+            }
+        };
+
+        struct ThreadCache
+        {
+            std::array<FreeList, MaxClasses> lists {};
+            RecyclingStats stats;
+
+            ~ThreadCache()
+            {
+                for (size_t cls = 0; cls < MaxClasses; ++cls)
+                    while (0 != lists[cls].count)
+                        if (_Ty* buffer = lists[cls].pop(); !toDepot(buffer, cls))
+                            upstream {}.deallocate(buffer, classCapacity(cls));
+            }
+        };
+
+        [[nodiscard]]
+        static Depot& depot()
+        {
+            static Depot instance;
+            return instance;
+        }
+
+        [[nodiscard]]
+        static ThreadCache& cache()
+        {
+            static thread_local ThreadCache instance;
+            return instance;
+        }
+
+        [[nodiscard]]
+        static constexpr size_t classCapacity(size_t cls) noexcept
+        {
+            size_t capacity = baseCapacity;
+            for (; cls > 0; --cls)
+                capacity *= classFactor;
+            return capacity;
+        }
+
+        /** Class of the smallest buffer fitting 'size' elements, MaxClasses if none: **/
+        [[nodiscard]]
+        static constexpr size_t classOf(size_t size) noexcept
+        {
+            size_t cls = 0;
+            for (size_t capacity = baseCapacity; capacity < size && cls < MaxClasses; capacity *= classFactor)
+                ++cls;
+            return cls;
+        }
+
+        /** Returns false if the depot is full: **/
+        static bool toDepot(_Ty* buffer, size_t cls)
+        {
+            Depot& shared = depot();
+            std::lock_guard lock { shared.mutex };
+            if (shared.lists[cls].count >= MaxDepot)
+                return false;
+            shared.lists[cls].push(buffer);
+            return true;
+        }
+
+        /** Moves the buffer to the depot or, once it is full, frees it: **/
+        static void release(ThreadCache& local, _Ty* buffer, size_t cls)
+        {
+            if (!toDepot(buffer, cls)) {
+                ++local.stats.released;
+                upstream {}.deallocate(buffer, classCapacity(cls));
+            }
+        }
+
+    public:
+
+        _Ty* allocate(size_t size)
+        {
+            const size_t cls = classOf(size);
+            if (cls >= MaxClasses)
+                return upstream::allocate(size);
+
+            ThreadCache& local = cache();
+            if (0 != local.lists[cls].count) {
+                ++local.stats.hits;
+                return local.lists[cls].pop();
+            }
+            {
+                Depot& shared = depot();
+                std::lock_guard lock { shared.mutex };
+                if (0 != shared.lists[cls].count) {
+                    ++local.stats.hits;
+                    ++local.stats.depotHits;
+                    return shared.lists[cls].pop();
+                }
+            }
+            ++local.stats.misses;
+            return upstream::allocate(classCapacity(cls));
+        }
+
+        void deallocate(_Ty* ptr, size_t size)
+        {
+            const size_t cls = classOf(size);
+            if (cls >= MaxClasses) {
+                ++cache().stats.released;
+                upstream::deallocate(ptr, size);
+                return;
+            }
+
+            if (ThreadCache& local = cache(); local.lists[cls].count < MaxCached)
+                local.lists[cls].push(ptr);
+            else
+                release(local, ptr, cls);
+        }
+
+        /** Counters of the calling thread: **/
+        [[nodiscard]]
+        static const RecyclingStats& Stats() noexcept {
+            return cache().stats;
+        }
+
+        static void ResetStats() noexcept {
+            cache().stats = RecyclingStats {};
+        }
+
+        /** Hands all buffers cached by the calling thread over to the depot (or frees them): **/
+        static void Trim()
+        {
+            ThreadCache& local = cache();
+            for (size_t cls = 0; cls < MaxClasses; ++cls)
+                while (0 != local.lists[cls].count)
+                    release(local, local.lists[cls].pop(), cls);
+        }
+    };
+
+    template<typename Type>
+    using RecyclingDVector = DVector<Type, RecyclingAllocator<Type>>;
+}
+
+#endif //CPPPROJECTS_RECYCLINGALLOCATOR_H
@@ -0,0 +1,164 @@
+/**============================================================================
+Name        : SequencedDVector.h
+Created on  : 19.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : DVector with the stable sequence numbers (log / queue cursors)
+============================================================================**/
+
+#ifndef CPPPROJECTS_SEQUENCEDDVECTOR_H
+#define CPPPROJECTS_SEQUENCEDDVECTOR_H
+
+#include <cstdint>
+#include "DVector.h"
+
+namespace DVector
+{
+    /** Every element keeps the sequence number it got when it was pushed: the element pushed to the
+     *  back gets the next number, the one pushed to the front gets the number before the first one.
+     *  Popping from the front does not renumber the others, so consumers may keep the sequence
+     *  numbers as cursors. All sequence lookups are O(1) arithmetic over the DVector indices. **/
+    template<typename Type,
+            typename Allocator = Allocator<Type>>
+    class SequencedDVector
+    {
+        using object_type = Type;
+        using size_type = size_t;
+        using sequence_type = uint64_t;
+
+    private:
+        DVector<object_type, Allocator> storage;
+
+        /** Sequence number of the first element (or of the next element pushed when empty): **/
+        sequence_type frontSequence { 0 };
+
+    public:
+
+        /** Default first number: leaves as many numbers for push_front() as for push_back(): **/
+        static constexpr sequence_type middleSequence { sequence_type { 1 } << 63 };
+
+        explicit SequencedDVector(const sequence_type firstSequence = middleSequence, const size_type capacity = 0):
+                storage (capacity), frontSequence { firstSequence } {
+        }
+
+        [[nodiscard]]
+        inline size_type Size() const noexcept {
+            return storage.Size();
+        }
+
+        [[nodiscard]]
+        inline bool Empty() const noexcept {
+            return storage.Empty();
+        }
+
+        [[nodiscard]]
+        inline sequence_type front_seq() const noexcept {
+            return frontSequence;
+        }
+
+        /** Sequence number of the last element, valid only if the vector is not empty: **/
+        [[nodiscard]]
+        inline sequence_type back_seq() const noexcept {
+            return frontSequence + storage.Size() - 1;
+        }
+
+        /** Sequence number the next push_back() will get: **/
+        [[nodiscard]]
+        inline sequence_type next_seq() const noexcept {
+            return frontSequence + storage.Size();
+        }
+
+        [[nodiscard]]
+        inline bool contains_seq(const sequence_type sequence) const noexcept {
+            return sequence >= frontSequence && sequence - frontSequence < storage.Size();
+        }
+
+        [[nodiscard]]
+        object_type& at_seq(const sequence_type sequence) const
+        {
+            if (!contains_seq(sequence))
+                throw std::out_of_range(std::format("{} sequence is out of range", sequence));
+            return storage[sequence - frontSequence];
+        }
+
+        [[nodiscard]]
+        object_type& operator[] (size_type index) const {
+            return storage[index];
+        }
+
+        [[nodiscard]]
+        object_type& Front() const noexcept {
+            return storage.Front();
+        }
+
+        [[nodiscard]]
+        object_type& Back() const noexcept {
+            return storage.Back();
+        }
+
+        /** Returns the sequence number of the new element: **/
+        template<typename ... Args>
+        sequence_type emplace_back(Args&&... params)
+        {
+            storage.emplace_back(std::forward<Args>(params)...);
+            return back_seq();
+        }
+
+        template<typename ... Args>
+        sequence_type emplace_front(Args&&... params)
+        {
+            if (0 == frontSequence)
+                throw std::out_of_range("no sequence number is left before the first one");
+            storage.emplace_front(std::forward<Args>(params)...);
+            return --frontSequence;
+        }
+
+        sequence_type push_back(const object_type& v) {
+            return emplace_back(v);
+        }
+
+        sequence_type push_back(object_type&& v) {
+            return emplace_back(std::move(v));
+        }
+
+        sequence_type push_front(const object_type& v) {
+            return emplace_front(v);
+        }
+
+        sequence_type push_front(object_type&& v) {
+            return emplace_front(std::move(v));
+        }
+
+        void pop_back() {
+            storage.pop_back();
+        }
+
+        void pop_front()
+        {
+            storage.pop_front();
+            ++frontSequence;
+        }
+
+        /** Drops all elements with the sequence number less than 'sequence', returns their count: **/
+        size_type pop_front_until(const sequence_type sequence)
+        {
+            if (sequence <= frontSequence)
+                return 0;
+
+            const size_type count = std::min<sequence_type>(sequence - frontSequence, storage.Size());
+            storage.pop_front(count);
+            frontSequence += count;
+            return count;
+        }
+
+        /** Numbering continues after the dropped elements: **/
+        void Clear() noexcept
+        {
+            frontSequence = next_seq();
+            storage.Clear();
+        }
+    };
+}
+
+#endif //CPPPROJECTS_SEQUENCEDDVECTOR_H
@@ -0,0 +1,265 @@
+/**============================================================================
+Name        : SharedDVector.h
+Created on  : 19.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Copy-on-write DVector with reference-counted storage
+============================================================================**/
+
+#ifndef CPPPROJECTS_SHAREDDVECTOR_H
+#define CPPPROJECTS_SHAREDDVECTOR_H
+
+#include <atomic>
+#include <memory>
+#include "DVector.h"
+
+namespace DVector
+{
+    /** Copies share the same storage. The storage is detached (deep-copied) on the first mutation
+     *  made through a copy which is not the only owner of it, so taking a snapshot is O(1).
+     *  The mutators do not hand out references: a reference kept from the time the storage was
+     *  unique would write into the snapshots taken later. Mutable() does, so it marks the storage
+     *  unshareable and the following copies are deep. **/
+    template<typename Type,
+            typename Allocator = Allocator<Type>>
+    class SharedDVector
+    {
+        using object_type = Type;
+        using storage_type = DVector<object_type, Allocator>;
+        using size_type = size_t;
+
+        /** Storage with its own owners count, unlike shared_ptr::use_count() it is read with the
+         *  acquire ordering, so the uniqueness check is safe against the copies dropped by other
+         *  threads: **/
+        struct Shared
+        {
+            storage_type vector;
+            std::atomic<long> owners { 1 };
+            bool unshareable { false };
+
+            template<typename ... Args>
+            explicit Shared(Args&&... params): vector (std::forward<Args>(params)...) {
+            }
+        };
+
+    private:
+        /** Shared elements collection, the empty shared one in the moved-from instance: **/
+        Shared* storage { nullptr };
+
+    private:
+
+        /** Empty storage taken by the moved-from instances, so they stay usable. It is pinned by one
+         *  extra owner: never unique (the mutators detach from it first) and never deleted: **/
+        [[nodiscard]]
+        static Shared* emptyStorage() noexcept
+        {
+            static Shared* const empty = [] {
+                Shared* shared = new Shared(size_type { 0 });
+                shared->owners.store(2, std::memory_order_relaxed);
+                return shared;
+            }();
+            empty->owners.fetch_add(1, std::memory_order_relaxed);
+            return empty;
+        }
+
+        void release() noexcept
+        {
+            if (nullptr != storage && 1 == storage->owners.fetch_sub(1, std::memory_order_acq_rel))
+                delete storage;
+            storage = nullptr;
+        }
+
+        [[nodiscard]]
+        bool unique() const noexcept {
+            return 1 == storage->owners.load(std::memory_order_acquire);
+        }
+
+        /** Makes sure that this instance is the only owner of the storage: **/
+        storage_type& mutableStorage()
+        {
+            if (!unique()) {
+                Shared* copy = new Shared(storage->vector);
+                release();
+                storage = copy;
+            }
+            return storage->vector;
+        }
+
+    public:
+
+        explicit SharedDVector(const size_type s = 0):
+                storage { new Shared(s) } {
+        }
+
+        explicit SharedDVector(storage_type&& vector):
+                storage { new Shared(std::move(vector)) } {
+        }
+
+        SharedDVector(const SharedDVector& other)
+        {
+            if (other.storage->unshareable) {
+                storage = new Shared(other.storage->vector);
+            } else {
+                storage = other.storage;
+                storage->owners.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        /** The moved-from instance is left empty (sharing the empty storage): **/
+        SharedDVector(SharedDVector&& other) noexcept:
+                storage { std::exchange(other.storage, emptyStorage()) } {
+        }
+
+        SharedDVector& operator=(const SharedDVector& other)
+        {
+            if (&other != this) {
+                SharedDVector localCopy(other);
+                swap(localCopy);
+            }
+            return *this;
+        }
+
+        SharedDVector& operator=(SharedDVector&& other) noexcept
+        {
+            if (&other != this) {
+                release();
+                storage = std::exchange(other.storage, emptyStorage());
+            }
+            return *this;
+        }
+
+        ~SharedDVector() {
+            release();
+        }
+
+    public:
+
+        [[nodiscard]]
+        const object_type& Front() const noexcept {
+            return storage->vector.Front();
+        }
+
+        [[nodiscard]]
+        const object_type& Back() const noexcept {
+            return storage->vector.Back();
+        }
+
+        [[nodiscard]]
+        const object_type& operator[] (size_type index) const {
+            return storage->vector[index];
+        }
+
+        [[nodiscard]]
+        const object_type& at(size_type index) const {
+            return storage->vector.at(index);
+        }
+
+        [[nodiscard]]
+        inline size_type Size() const noexcept {
+            return storage->vector.Size();
+        }
+
+        [[nodiscard]]
+        inline size_type Capacity() const noexcept {
+            return storage->vector.Capacity();
+        }
+
+        [[nodiscard]]
+        inline bool Empty() const noexcept {
+            return storage->vector.Empty();
+        }
+
+        [[nodiscard]]
+        inline const object_type* Data() const noexcept {
+            return storage->vector.Data();
+        }
+
+        /** Number of SharedDVector instances sharing the same storage: **/
+        [[nodiscard]]
+        inline long UseCount() const noexcept {
+            return storage->owners.load(std::memory_order_acquire);
+        }
+
+        [[nodiscard]]
+        inline bool IsShared() const noexcept {
+            return !unique();
+        }
+
+        /** Read-only view of the underlying storage: **/
+        [[nodiscard]]
+        inline const storage_type& Storage() const noexcept {
+            return storage->vector;
+        }
+
+        /** Mutable element access, detaches the storage if it is shared. The reference escapes, so
+         *  the copies made from now on are deep: **/
+        [[nodiscard]]
+        object_type& Mutable(size_type index)
+        {
+            object_type& value = mutableStorage().at(index);
+            storage->unshareable = true;
+            return value;
+        }
+
+        /** Replaces the element, detaches the storage if it is shared: **/
+        void Set(size_type index, object_type value) {
+            mutableStorage().at(index) = std::move(value);
+        }
+
+        void Detach() {
+            mutableStorage();
+        }
+
+        void Clear()
+        {
+            if (unique()) {
+                storage->vector.Clear();
+            } else {
+                Shared* empty = new Shared(storage->vector.Capacity());
+                release();
+                storage = empty;
+            }
+        }
+
+        void push_back(const object_type& v) {
+            mutableStorage().push_back(v);
+        }
+
+        void push_back(object_type&& v) {
+            mutableStorage().push_back(std::move(v));
+        }
+
+        void push_front(const object_type& v) {
+            mutableStorage().push_front(v);
+        }
+
+        void push_front(object_type&& v) {
+            mutableStorage().push_front(std::move(v));
+        }
+
+        void pop_back() {
+            mutableStorage().pop_back();
+        }
+
+        void pop_front() {
+            mutableStorage().pop_front();
+        }
+
+        template<typename ... Args>
+        void emplace_back(Args&&... params) {
+            mutableStorage().emplace_back(std::forward<Args>(params)...);
+        }
+
+        template<typename ... Args>
+        void emplace_front(Args&&... params) {
+            mutableStorage().emplace_front(std::forward<Args>(params)...);
+        }
+
+        void swap(SharedDVector& other) noexcept {
+            std::swap(storage, other.storage);
+        }
+    };
+}
+
+#endif //CPPPROJECTS_SHAREDDVECTOR_H
@@ -0,0 +1,368 @@
+/**============================================================================
+Name        : ShmDVector.h
+Created on  : 19.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Cross-process single-producer / single-consumer DVector in shared memory
+============================================================================**/
+
+#ifndef CPPPROJECTS_SHMDVECTOR_H
+#define CPPPROJECTS_SHMDVECTOR_H
+
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <span>
+#include <string>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "DVector.h"
+
+namespace DVector
+{
+    /** The segment (memfd or shm_open) starts with the header page, the elements live in a ring
+     *  placed further in the same file. Nothing in the segment is a pointer: the ring is referred
+     *  by its file offset, the elements by the 64 bit 'left' / 'right' counters, so every process
+     *  maps the segment wherever it likes. The producer owns 'right', the consumer owns 'left'.
+     *
+     *  A full ring is not waited on, it grows: the producer appends a ring 4 times larger to the
+     *  file, copies the live elements into it and publishes its 'layout' before the next 'right'.
+     *  The old ring is never written again, so the consumer keeps reading it until it sees the
+     *  layout change after loading 'right' (the capacity recheck) and remaps. Right after that the
+     *  consumer returns the pages of all the rings before the new one to the system. **/
+    template<typename Type>
+    class ShmDVector
+    {
+        using object_type = Type;
+        using size_type = size_t;
+
+        static_assert(std::is_trivially_copyable_v<object_type>,
+                      "Only the trivially copyable types can be shared between the processes");
+        static_assert(std::atomic<uint64_t>::is_always_lock_free,
+                      "Lock-free 64 bit atomics are required in the shared memory");
+
+        static constexpr uint32_t magic { 0x52544456 };
+        static constexpr size_type growthFactor { 4 };
+
+        struct Header
+        {
+            uint32_t magic { 0 };
+            uint32_t elementSize { 0 };
+
+            /** Current ring: its file offset (page aligned) ORed with log2 of its capacity: **/
+            std::atomic<uint64_t> layout { 0 };
+
+            alignas(cacheLineSize) std::atomic<uint64_t> right { 0 };
+            alignas(cacheLineSize) std::atomic<uint64_t> left { 0 };
+        };
+
+        /** Ring mapped by this process: **/
+        struct View
+        {
+            std::byte* base { nullptr };
+            size_type bytes { 0 };
+            size_type capacity { 0 };
+            uint64_t layout { 0 };
+
+            [[nodiscard]]
+            inline object_type* slot(const uint64_t index) const noexcept {
+                return reinterpret_cast<object_type*>(base) + (index & (capacity - 1));
+            }
+
+            void unmap() noexcept
+            {
+                if (nullptr != base)
+                    ::munmap(base, bytes);
+                base = nullptr;
+            }
+        };
+
+    private:
+        int fd { -1 };
+        size_type pageSize { static_cast<size_type>(::sysconf(_SC_PAGESIZE)) };
+        Header* header { nullptr };
+
+        /** The producer and the consumer side of this process, each with its own mapping and the
+         *  cached copy of the other side's counter: **/
+        View producer;
+        View consumer;
+        uint64_t cachedLeft { 0 };
+        uint64_t cachedRight { 0 };
+
+    private:
+
+        [[noreturn]]
+        static void fail(const char* what) {
+            throw std::system_error(errno, std::generic_category(), what);
+        }
+
+        [[nodiscard]]
+        size_type ringBytes(const size_type capacity) const noexcept {
+            return (capacity * sizeof(object_type) + pageSize - 1) / pageSize * pageSize;
+        }
+
+        [[nodiscard]]
+        static constexpr uint64_t offsetOf(const uint64_t layout) noexcept {
+            return layout & ~uint64_t { 0xFF };
+        }
+
+        [[nodiscard]]
+        static constexpr size_type capacityOf(const uint64_t layout) noexcept {
+            return size_type { 1 } << (layout & 0xFF);
+        }
+
+        void map(View& view, const uint64_t layout)
+        {
+            const size_type bytes = ringBytes(capacityOf(layout));
+            void* base = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, static_cast<off_t>(offsetOf(layout)));
+            if (MAP_FAILED == base)
+                fail("ShmDVector: can not map the ring");
+
+            view.unmap();
+            view = View { static_cast<std::byte*>(base), bytes, capacityOf(layout), layout };
+        }
+
+        /** Appends the ring of 'capacity' elements to the file, returns its layout: **/
+        [[nodiscard]]
+        uint64_t appendRing(const size_type capacity)
+        {
+            struct stat status {};
+            if (0 != ::fstat(fd, &status))
+                fail("ShmDVector: can not stat the segment");
+
+            const uint64_t offset = static_cast<uint64_t>(status.st_size);
+            if (0 != ::ftruncate(fd, static_cast<off_t>(offset + ringBytes(capacity))))
+                fail("ShmDVector: can not grow the segment");
+            return offset | static_cast<uint64_t>(std::countr_zero(capacity));
+        }
+
+        /** Copies 'count' elements starting at 'index' between the rings of different capacity: **/
+        static void copyRing(const View& from, const View& to, uint64_t index, size_type count) noexcept
+        {
+            while (0 != count)
+            {
+                const size_type fromRoom = from.capacity - (index & (from.capacity - 1));
+                const size_type toRoom = to.capacity - (index & (to.capacity - 1));
+                const size_type chunk = std::min({ count, fromRoom, toRoom });
+                std::memcpy(to.slot(index), from.slot(index), chunk * sizeof(object_type));
+                index += chunk;
+                count -= chunk;
+            }
+        }
+
+        /** Producer side: makes room for 'count' elements after 'right' when the ring is full: **/
+        void reserve(const uint64_t right, const size_type count)
+        {
+            if (right + count - cachedLeft <= producer.capacity)
+                return;
+            cachedLeft = header->left.load(std::memory_order_acquire);
+            if (right + count - cachedLeft <= producer.capacity)
+                return;
+
+            const size_type live = right - cachedLeft;
+            const size_type capacity = std::bit_ceil(std::max(producer.capacity * growthFactor, live + count));
+            View ring;
+            map(ring, appendRing(capacity));
+            copyRing(producer, ring, cachedLeft, live);
+
+            producer.unmap();
+            producer = ring;
+            header->layout.store(producer.layout, std::memory_order_release);
+        }
+
+        /** Consumer side, called after loading 'right': switches to the latest ring if it changed.
+         *  The rings are appended to the file in order and the producer never touches one again after
+         *  publishing a newer layout, so everything between the header and the new ring is released: **/
+        void syncConsumer()
+        {
+            const uint64_t layout = header->layout.load(std::memory_order_acquire);
+            if (layout == consumer.layout)
+                return;
+            const uint64_t first = 0 == consumer.layout ? pageSize : offsetOf(consumer.layout);
+            map(consumer, layout);
+            if (offsetOf(layout) > first)
+                ::fallocate(fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, static_cast<off_t>(first),
+                            static_cast<off_t>(offsetOf(layout) - first));
+        }
+
+        void close() noexcept
+        {
+            producer.unmap();
+            consumer.unmap();
+            if (nullptr != header)
+                ::munmap(header, pageSize);
+            if (-1 != fd)
+                ::close(fd);
+            header = nullptr;
+            fd = -1;
+        }
+
+        /** Takes the ownership of the descriptor: **/
+        ShmDVector(const int descriptor, const size_type capacity, const bool create): fd { descriptor }
+        {
+            try
+            {
+                if (create && 0 != ::ftruncate(fd, static_cast<off_t>(pageSize)))
+                    fail("ShmDVector: can not size the segment");
+
+                void* base = ::mmap(nullptr, pageSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                if (MAP_FAILED == base)
+                    fail("ShmDVector: can not map the header");
+                header = static_cast<Header*>(base);
+
+                if (create) {
+                    std::construct_at(header);
+                    header->magic = magic;
+                    header->elementSize = sizeof(object_type);
+                    header->layout.store(appendRing(std::bit_ceil(std::max<size_type>(capacity, 2))), std::memory_order_release);
+                } else if (magic != header->magic || sizeof(object_type) != header->elementSize) {
+                    throw std::invalid_argument(std::format("not a ShmDVector of {} byte elements", sizeof(object_type)));
+                }
+
+                map(producer, header->layout.load(std::memory_order_acquire));
+                cachedLeft = header->left.load(std::memory_order_acquire);
+                cachedRight = header->right.load(std::memory_order_acquire);
+            }
+            catch (...)
+            {
+                close();
+                throw;
+            }
+        }
+
+    public:
+
+        /** Anonymous segment (memfd), shared through fork() or by passing Descriptor(): **/
+        [[nodiscard]]
+        static ShmDVector Create(const size_type capacity = 1024)
+        {
+            const int descriptor = ::memfd_create("ShmDVector", MFD_CLOEXEC);
+            if (-1 == descriptor)
+                fail("ShmDVector: memfd_create failed");
+            return ShmDVector(descriptor, capacity, true);
+        }
+
+        /** Named POSIX segment, fails if it exists. The name is removed again if the setup fails: **/
+        [[nodiscard]]
+        static ShmDVector Create(const std::string& name, const size_type capacity = 1024)
+        {
+            const int descriptor = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+            if (-1 == descriptor)
+                fail("ShmDVector: shm_open failed");
+            try {
+                return ShmDVector(descriptor, capacity, true);
+            } catch (...) {
+                ::shm_unlink(name.c_str());
+                throw;
+            }
+        }
+
+        [[nodiscard]]
+        static ShmDVector Open(const std::string& name)
+        {
+            const int descriptor = ::shm_open(name.c_str(), O_RDWR, 0);
+            if (-1 == descriptor)
+                fail("ShmDVector: shm_open failed");
+            return ShmDVector(descriptor, 0, false);
+        }
+
+        /** Opens the segment by the descriptor received from the other process, duplicates it: **/
+        [[nodiscard]]
+        static ShmDVector Attach(const int descriptor)
+        {
+            const int duplicate = ::dup(descriptor);
+            if (-1 == duplicate)
+                fail("ShmDVector: dup failed");
+            return ShmDVector(duplicate, 0, false);
+        }
+
+        static void Unlink(const std::string& name) noexcept {
+            ::shm_unlink(name.c_str());
+        }
+
+        ShmDVector(const ShmDVector&) = delete;
+        ShmDVector& operator=(const ShmDVector&) = delete;
+
+        ~ShmDVector() {
+            close();
+        }
+
+        [[nodiscard]]
+        inline int Descriptor() const noexcept {
+            return fd;
+        }
+
+        /** Snapshot, exact only on a quiescent vector: **/
+        [[nodiscard]]
+        size_type Size() const noexcept {
+            return header->right.load(std::memory_order_acquire) - header->left.load(std::memory_order_acquire);
+        }
+
+        [[nodiscard]]
+        bool Empty() const noexcept {
+            return 0 == Size();
+        }
+
+        [[nodiscard]]
+        size_type Capacity() const noexcept {
+            return capacityOf(header->layout.load(std::memory_order_acquire));
+        }
+
+        /** Producer: **/
+        void push_back(const object_type& value)
+        {
+            const uint64_t right = header->right.load(std::memory_order_relaxed);
+            reserve(right, 1);
+            std::memcpy(producer.slot(right), &value, sizeof(object_type));
+            header->right.store(right + 1, std::memory_order_release);
+        }
+
+        /** Producer, publishes all the values at once: **/
+        void push_back(std::span<const object_type> values)
+        {
+            if (values.empty())
+                return;
+
+            const uint64_t right = header->right.load(std::memory_order_relaxed);
+            reserve(right, values.size());
+
+            const size_type first = std::min(values.size(), producer.capacity - (right & (producer.capacity - 1)));
+            std::memcpy(producer.slot(right), values.data(), first * sizeof(object_type));
+            std::memcpy(producer.slot(right + first), values.data() + first, (values.size() - first) * sizeof(object_type));
+            header->right.store(right + values.size(), std::memory_order_release);
+        }
+
+        /** Consumer, false if there is nothing to pop: **/
+        bool pop_front(object_type& value)
+        {
+            return 1 == pop_front(std::span<object_type> { &value, 1 });
+        }
+
+        /** Consumer, pops up to values.size() elements, returns their number: **/
+        size_type pop_front(std::span<object_type> values)
+        {
+            const uint64_t left = header->left.load(std::memory_order_relaxed);
+            if (left + values.size() > cachedRight)
+                cachedRight = header->right.load(std::memory_order_acquire);
+
+            const size_type count = std::min<size_type>(values.size(), cachedRight - left);
+            if (0 == count)
+                return 0;
+
+            syncConsumer();
+            const size_type first = std::min(count, consumer.capacity - (left & (consumer.capacity - 1)));
+            std::memcpy(values.data(), consumer.slot(left), first * sizeof(object_type));
+            std::memcpy(values.data() + first, consumer.slot(left + first), (count - first) * sizeof(object_type));
+            header->left.store(left + count, std::memory_order_release);
+            return count;
+        }
+    };
+}
+
+#endif //CPPPROJECTS_SHMDVECTOR_H
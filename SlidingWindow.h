@@ -0,0 +1,216 @@
+/**============================================================================
+Name        : SlidingWindow.h
+Created on  : 19.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Sliding window aggregates on top of DVector
+============================================================================**/
+
+#ifndef CPPPROJECTS_SLIDINGWINDOW_H
+#define CPPPROJECTS_SLIDINGWINDOW_H
+
+#include <tuple>
+#include <functional>
+#include "DVector.h"
+
+namespace DVector
+{
+    /** Aggregates are the policies with the nested State<Type> template. The state is notified about
+     *  every value entering the window (push) and every value leaving it (pop), oldest first. **/
+    namespace Aggregate
+    {
+        /** Monotonic deque: the front always holds the minimum of the window: **/
+        template<typename Compare>
+        struct MonotonicExtremum
+        {
+            template<typename Type>
+            class State
+            {
+                DVector<Type> candidates;
+                [[no_unique_address]] Compare compare {};
+
+            public:
+
+                void push(const Type& value)
+                {
+                    while (!candidates.Empty() && compare(value, candidates.Back()))
+                        candidates.pop_back();
+                    candidates.push_back(value);
+                }
+
+                void pop(const Type& value)
+                {
+                    if (!compare(candidates.Front(), value) && !compare(value, candidates.Front()))
+                        candidates.pop_front();
+                }
+
+                [[nodiscard]]
+                const Type& Value() const noexcept {
+                    return candidates.Front();
+                }
+            };
+        };
+
+        using Min = MonotonicExtremum<std::less<>>;
+        using Max = MonotonicExtremum<std::greater<>>;
+
+        struct Sum
+        {
+            template<typename Type>
+            class State
+            {
+                Type sum {};
+
+            public:
+
+                void push(const Type& value) {
+                    sum += value;
+                }
+
+                void pop(const Type& value) {
+                    sum -= value;
+                }
+
+                [[nodiscard]]
+                const Type& Value() const noexcept {
+                    return sum;
+                }
+            };
+        };
+
+        struct Mean
+        {
+            template<typename Type>
+            class State
+            {
+                Type sum {};
+                size_t count { 0 };
+
+            public:
+
+                void push(const Type& value) {
+                    sum += value;
+                    ++count;
+                }
+
+                void pop(const Type& value) {
+                    sum -= value;
+                    --count;
+                }
+
+                [[nodiscard]]
+                double Value() const noexcept {
+                    return 0 == count ? 0.0 : static_cast<double>(sum) / static_cast<double>(count);
+                }
+            };
+        };
+
+        /** Two-stack aggregation for any associative operation (no inverse required). The back stack
+         *  keeps the running aggregate of the new values, the front stack keeps suffix aggregates of
+         *  the old ones and is refilled from the back stack once it runs empty. **/
+        template<typename Operation>
+        struct Fold
+        {
+            template<typename Type>
+            class State
+            {
+                DVector<Type> backValues;
+                Type backAggregate {};
+                DVector<Type> frontAggregates;
+                [[no_unique_address]] Operation operation {};
+
+            public:
+
+                void push(const Type& value)
+                {
+                    backAggregate = backValues.Empty() ? value : operation(backAggregate, value);
+                    backValues.push_back(value);
+                }
+
+                void pop(const Type&)
+                {
+                    if (frontAggregates.Empty())
+                    {
+                        while (!backValues.Empty()) {
+                            const Type& value = backValues.Back();
+                            frontAggregates.push_back(frontAggregates.Empty() ? value : operation(value, frontAggregates.Back()));
+                            backValues.pop_back();
+                        }
+                    }
+                    frontAggregates.pop_back();
+                }
+
+                [[nodiscard]]
+                Type Value() const
+                {
+                    if (frontAggregates.Empty())
+                        return backAggregate;
+                    if (backValues.Empty())
+                        return frontAggregates.Back();
+                    return operation(frontAggregates.Back(), backAggregate);
+                }
+            };
+        };
+    }
+
+    /** Count based window of the last 'windowSize' values. Every update is amortized O(1)
+     *  and, once the DVectors involved have grown to fit the window, allocation free. **/
+    template<typename Type, typename ... Aggregates>
+    class SlidingWindow
+    {
+        using object_type = Type;
+        using size_type = size_t;
+
+    private:
+        DVector<object_type> window;
+        size_type windowSize { 0 };
+        std::tuple<typename Aggregates::template State<object_type>...> states;
+
+    public:
+
+        explicit SlidingWindow(const size_type size):
+                window (2 * size + 2), windowSize { size > 0 ? size : 1 } {
+        }
+
+        /** Adds the new value evicting the oldest one once the window is full: **/
+        void push(const object_type& value)
+        {
+            if (window.Size() == windowSize) {
+                std::apply([this](auto&... state) { (state.pop(window.Front()), ...); }, states);
+                window.pop_front();
+            }
+
+            window.push_back(value);
+            std::apply([&value](auto&... state) { (state.push(value), ...); }, states);
+        }
+
+        template<typename Aggregate>
+        [[nodiscard]]
+        decltype(auto) Get() const {
+            return std::get<typename Aggregate::template State<object_type>>(states).Value();
+        }
+
+        [[nodiscard]]
+        inline size_type Size() const noexcept {
+            return window.Size();
+        }
+
+        [[nodiscard]]
+        inline size_type WindowSize() const noexcept {
+            return windowSize;
+        }
+
+        [[nodiscard]]
+        inline bool Full() const noexcept {
+            return window.Size() == windowSize;
+        }
+
+        [[nodiscard]]
+        inline const DVector<object_type>& Values() const noexcept {
+            return window;
+        }
+    };
+}
+
+#endif //CPPPROJECTS_SLIDINGWINDOW_H
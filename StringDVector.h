@@ -0,0 +1,170 @@
+/**============================================================================
+Name        : StringDVector.h
+Created on  : 19.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Variable-length strings packed into one two-sided byte arena
+============================================================================**/
+
+#ifndef CPPPROJECTS_STRINGDVECTOR_H
+#define CPPPROJECTS_STRINGDVECTOR_H
+
+#include <cstring>
+#include <string_view>
+#include "DVector.h"
+
+namespace DVector
+{
+    /** All the bytes live in one DVector<char>, the strings are delimited by the parallel boundary
+     *  array of Size() + 1 positions. Positions are counted from an arbitrary origin in the modular
+     *  arithmetic, so push_front() only subtracts from the first one and nothing is renumbered.
+     *  The string 'i' is [boundaries[i], boundaries[i + 1]) shifted by 'boundaries[0]': **/
+    class StringDVector
+    {
+        using size_type = size_t;
+        using position_type = size_t;
+
+    private:
+        DVector<char> bytes;
+        DVector<position_type> boundaries;
+
+    public:
+
+        explicit StringDVector(const size_type bytesCapacity = 0,
+                               const size_type stringsCapacity = 0):
+                bytes (bytesCapacity), boundaries (stringsCapacity) {
+            boundaries.push_back(0);
+        }
+
+        [[nodiscard]]
+        inline size_type Size() const noexcept {
+            return boundaries.Size() - 1;
+        }
+
+        [[nodiscard]]
+        inline bool Empty() const noexcept {
+            return 1 == boundaries.Size();
+        }
+
+        /** Total length of all the strings: **/
+        [[nodiscard]]
+        inline size_type Bytes() const noexcept {
+            return bytes.Size();
+        }
+
+        [[nodiscard]]
+        std::string_view operator[] (size_type index) const noexcept
+        {
+            const position_type begin = boundaries[index];
+            return { bytes.Data() + (begin - boundaries.Front()), boundaries[index + 1] - begin };
+        }
+
+        [[nodiscard]]
+        std::string_view at(size_type index) const
+        {
+            if (index >= Size())
+                throw std::out_of_range(std::format("{} index is out of range", index));
+            return (*this)[index];
+        }
+
+        [[nodiscard]]
+        std::string_view Front() const noexcept {
+            return (*this)[0];
+        }
+
+        [[nodiscard]]
+        std::string_view Back() const noexcept {
+            return (*this)[Size() - 1];
+        }
+
+        /** The views stay valid until the next push, ShrinkToFit() or remove_if(): **/
+        void push_back(const std::string_view string)
+        {
+            const std::span<char> room = bytes.prepare_back(string.size());
+            if (!string.empty())
+                std::memcpy(room.data(), string.data(), string.size());
+            bytes.commit_back(string.size());
+            boundaries.push_back(boundaries.Back() + string.size());
+        }
+
+        void push_front(const std::string_view string)
+        {
+            const std::span<char> room = bytes.prepare_front(string.size());
+            if (!string.empty())
+                std::memcpy(room.data(), string.data(), string.size());
+            bytes.commit_front(string.size());
+            boundaries.push_front(boundaries.Front() - string.size());
+        }
+
+        void pop_back()
+        {
+            const size_type length = boundaries[Size()] - boundaries[Size() - 1];
+            bytes.pop_back(length);
+            boundaries.pop_back();
+        }
+
+        void pop_front()
+        {
+            const size_type length = boundaries[1] - boundaries[0];
+            bytes.pop_front(length);
+            boundaries.pop_front();
+        }
+
+        void Clear() noexcept
+        {
+            bytes.Clear();
+            boundaries.Clear();
+            boundaries.push_back(0);
+        }
+
+        void Reserve(const size_type frontBytes, const size_type backBytes,
+                     const size_type frontStrings, const size_type backStrings)
+        {
+            bytes.Reserve(frontBytes, backBytes);
+            boundaries.Reserve(frontStrings, backStrings);
+        }
+
+        void ShrinkToFit()
+        {
+            bytes.ShrinkToFit();
+            boundaries.ShrinkToFit();
+        }
+
+        /** Bulk compaction: drops the strings matching the predicate sliding the rest of the bytes
+         *  and the boundaries down in a single pass. Returns the number of the strings removed: **/
+        template<typename Predicate>
+        size_type remove_if(Predicate&& predicate)
+        {
+            const size_type count = Size();
+            const position_type origin = boundaries.Front();
+            position_type write = origin;
+            size_type kept = 0;
+
+            for (size_type idx = 0; idx < count; ++idx)
+            {
+                const std::string_view string = (*this)[idx];
+                if (predicate(string))
+                    continue;
+                char* const destination = bytes.Data() + (write - origin);
+                if (destination != string.data())
+                    std::memmove(destination, string.data(), string.size());
+                write += string.size();
+                boundaries[++kept] = write;
+            }
+
+            bytes.pop_back(bytes.Size() - (write - origin));
+            boundaries.pop_back(count - kept);
+            return count - kept;
+        }
+
+        template<typename Callback>
+        void forEach(Callback&& callback) const
+        {
+            for (size_type idx = 0, count = Size(); idx < count; ++idx)
+                callback((*this)[idx]);
+        }
+    };
+}
+
+#endif //CPPPROJECTS_STRINGDVECTOR_H
@@ -0,0 +1,324 @@
+/**============================================================================
+Name        : TieredDVector.h
+Created on  : 19.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Tiered vector: DVector of the fixed-size circular blocks
+============================================================================**/
+
+#ifndef CPPPROJECTS_TIEREDDVECTOR_H
+#define CPPPROJECTS_TIEREDDVECTOR_H
+
+#include <bit>
+#include <span>
+#include "DVector.h"
+
+namespace DVector
+{
+    /** Elements are kept in the circular blocks of 'BlockSize' slots, all of them full except the
+     *  first and the last one, so the index is mapped to the block with a division. The blocks are
+     *  stored in the DVector making the new blocks at both ends O(1). Insert and erase shift the
+     *  elements inside one block and then move one element per block up to the last one, which is
+     *  O(BlockSize + Size() / BlockSize): choosing 'BlockSize' close to sqrt(Size()) gives O(sqrt(n)). **/
+    template<typename Type,
+             size_t BlockSize = 1024,
+             typename Allocator = Allocator<Type>>
+    class TieredDVector
+    {
+        using object_type = Type;
+        using pointer = object_type*;
+        using size_type = size_t;
+
+        static_assert(BlockSize > 1 && std::has_single_bit(BlockSize), "Block size must be a power of two");
+
+        static constexpr size_type mask { BlockSize - 1 };
+
+        /** Circular buffer of 'BlockSize' slots: **/
+        class Block
+        {
+            pointer data { nullptr };
+            size_type head { 0 };
+            size_type count { 0 };
+
+        public:
+
+            Block(): data { Allocator {}.allocate(BlockSize) } {
+            }
+
+            Block(Block&& other) noexcept:
+                    data { std::exchange(other.data, nullptr) },
+                    head { std::exchange(other.head, 0) },
+                    count { std::exchange(other.count, 0) } {
+            }
+
+            Block(const Block&) = delete;
+            Block& operator=(const Block&) = delete;
+            Block& operator=(Block&&) = delete;
+
+            ~Block()
+            {
+                if (nullptr == data)
+                    return;
+                for (size_type idx = 0; idx < count; ++idx)
+                    std::destroy_at(&(*this)[idx]);
+                Allocator {}.deallocate(data, BlockSize);
+            }
+
+            [[nodiscard]]
+            inline object_type& operator[] (size_type index) const noexcept {
+                return data[(head + index) & mask];
+            }
+
+            [[nodiscard]]
+            inline size_type Size() const noexcept {
+                return count;
+            }
+
+            [[nodiscard]]
+            inline bool Full() const noexcept {
+                return BlockSize == count;
+            }
+
+            /** One or two contiguous parts, depending on the wrap-around: **/
+            template<typename Callback>
+            void forEachSpan(Callback&& callback) const
+            {
+                const size_type first = std::min(count, BlockSize - head);
+                callback(std::span<object_type> { data + head, first });
+                if (first < count)
+                    callback(std::span<object_type> { data, count - first });
+            }
+
+            void push_back(object_type&& value)
+            {
+                std::construct_at(data + ((head + count) & mask), std::move(value));
+                ++count;
+            }
+
+            void push_front(object_type&& value)
+            {
+                std::construct_at(data + ((head - 1) & mask), std::move(value));
+                head = (head - 1) & mask;
+                ++count;
+            }
+
+            object_type pop_back()
+            {
+                object_type& last = (*this)[--count];
+                object_type value { std::move(last) };
+                std::destroy_at(&last);
+                return value;
+            }
+
+            object_type pop_front()
+            {
+                object_type& first = (*this)[0];
+                object_type value { std::move(first) };
+                std::destroy_at(&first);
+                head = (head + 1) & mask;
+                --count;
+                return value;
+            }
+
+            /** Block must not be full. Shifts the shorter side: **/
+            void insert(const size_type index, object_type&& value)
+            {
+                if (0 == index)
+                    return push_front(std::move(value));
+                if (index < count / 2) {
+                    push_front(std::move((*this)[0]));
+                    for (size_type idx = 1; idx < index; ++idx)
+                        (*this)[idx] = std::move((*this)[idx + 1]);
+                    (*this)[index] = std::move(value);
+                } else {
+                    if (index == count)
+                        return push_back(std::move(value));
+                    push_back(std::move((*this)[count - 1]));
+                    for (size_type idx = count - 2; idx > index; --idx)
+                        (*this)[idx] = std::move((*this)[idx - 1]);
+                    (*this)[index] = std::move(value);
+                }
+            }
+
+            void erase(const size_type index)
+            {
+                if (index < count / 2) {
+                    for (size_type idx = index; idx > 0; --idx)
+                        (*this)[idx] = std::move((*this)[idx - 1]);
+                    pop_front();
+                } else {
+                    for (size_type idx = index; idx + 1 < count; ++idx)
+                        (*this)[idx] = std::move((*this)[idx + 1]);
+                    pop_back();
+                }
+            }
+        };
+
+    private:
+        DVector<Block> blocks;
+        size_type size { 0 };
+
+    private:
+
+        /** Block index and position inside of it, only the first block may be shorter in front: **/
+        [[nodiscard]]
+        std::pair<size_type, size_type> locate(const size_type index) const noexcept
+        {
+            const size_type firstCount = blocks.Front().Size();
+            if (index < firstCount)
+                return { 0, index };
+            const size_type rest = index - firstCount;
+            return { 1 + rest / BlockSize, rest & mask };
+        }
+
+    public:
+
+        TieredDVector() = default;
+
+        TieredDVector(const TieredDVector&) = delete;
+        TieredDVector& operator=(const TieredDVector&) = delete;
+
+        TieredDVector(TieredDVector&&) noexcept = default;
+        TieredDVector& operator=(TieredDVector&&) noexcept = default;
+
+        [[nodiscard]]
+        inline size_type Size() const noexcept {
+            return size;
+        }
+
+        [[nodiscard]]
+        inline bool Empty() const noexcept {
+            return 0 == size;
+        }
+
+        [[nodiscard]]
+        inline size_type BlockCount() const noexcept {
+            return blocks.Size();
+        }
+
+        [[nodiscard]]
+        object_type& operator[] (size_type index) const noexcept
+        {
+            const auto [block, position] = locate(index);
+            return blocks[block][position];
+        }
+
+        [[nodiscard]]
+        object_type& at(size_type index) const
+        {
+            if (index >= size)
+                throw std::out_of_range(std::format("{} index is out of range", index));
+            return (*this)[index];
+        }
+
+        [[nodiscard]]
+        object_type& Front() const noexcept {
+            return blocks.Front()[0];
+        }
+
+        [[nodiscard]]
+        object_type& Back() const noexcept {
+            return blocks.Back()[blocks.Back().Size() - 1];
+        }
+
+        void push_back(object_type value)
+        {
+            if (blocks.Empty() || blocks.Back().Full())
+                blocks.emplace_back();
+            blocks.Back().push_back(std::move(value));
+            ++size;
+        }
+
+        void push_front(object_type value)
+        {
+            if (blocks.Empty() || blocks.Front().Full())
+                blocks.emplace_front();
+            blocks.Front().push_front(std::move(value));
+            ++size;
+        }
+
+        void pop_back()
+        {
+            blocks.Back().pop_back();
+            if (0 == blocks.Back().Size())
+                blocks.pop_back();
+            --size;
+        }
+
+        void pop_front()
+        {
+            blocks.Front().pop_front();
+            if (0 == blocks.Front().Size())
+                blocks.pop_front();
+            --size;
+        }
+
+        /** Inserts before 'index'. A full block passes its last element to the next block's front: **/
+        void insert(const size_type index, object_type value)
+        {
+            if (index >= size)
+                return push_back(std::move(value));
+            if (0 == index)
+                return push_front(std::move(value));
+
+            const auto [block, position] = locate(index);
+            if (blocks[block].Full())
+            {
+                object_type carry = blocks[block].pop_back();
+                size_type next = block + 1;
+                for (; next < blocks.Size() && blocks[next].Full(); ++next) {
+                    object_type last = blocks[next].pop_back();
+                    blocks[next].push_front(std::move(carry));
+                    carry = std::move(last);
+                }
+                if (next == blocks.Size())
+                    blocks.emplace_back();
+                blocks[next].push_front(std::move(carry));
+            }
+            blocks[block].insert(position, std::move(value));
+            ++size;
+        }
+
+        /** Erases at 'index', the following blocks pass their first elements back to stay full: **/
+        void erase(const size_type index)
+        {
+            const auto [block, position] = locate(index);
+            blocks[block].erase(position);
+            if (0 != block)
+                for (size_type next = block + 1; next < blocks.Size(); ++next)
+                    blocks[next - 1].push_back(blocks[next].pop_front());
+
+            if (0 == blocks.Back().Size())
+                blocks.pop_back();
+            else if (0 == blocks.Front().Size())
+                blocks.pop_front();
+            --size;
+        }
+
+        void Clear() noexcept
+        {
+            blocks.Clear();
+            size = 0;
+        }
+
+        /** Calls back with the contiguous parts of the elements, in order: **/
+        template<typename Callback>
+        void forEachSpan(Callback&& callback) const
+        {
+            for (const Block& block: blocks)
+                block.forEachSpan(callback);
+        }
+
+        template<typename Callback>
+        void forEach(Callback&& callback) const
+        {
+            forEachSpan([&callback](std::span<object_type> part) {
+                for (object_type& value: part)
+                    callback(value);
+            });
+        }
+    };
+}
+
+#endif //CPPPROJECTS_TIEREDDVECTOR_H
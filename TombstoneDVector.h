@@ -0,0 +1,278 @@
+/**============================================================================
+Name        : TombstoneDVector.h
+Created on  : 19.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : DVector with the lazy erase (tombstones) and batched compaction
+============================================================================**/
+
+#ifndef CPPPROJECTS_TOMBSTONEDVECTOR_H
+#define CPPPROJECTS_TOMBSTONEDVECTOR_H
+
+#include <bit>
+#include <cstring>
+#include <iterator>
+#include "DVector.h"
+
+namespace DVector
+{
+    /** lazy_erase() only sets the bit in the side bitmap, the erased elements stay in their slots
+     *  until the dead ratio passes the threshold and one compaction pass removes all of them. The
+     *  slot indices are the DVector indices: stable between the compactions except for push_front(),
+     *  which shifts them by one. Size() and the iteration skip the tombstones, scanning the bitmap
+     *  64 slots at a time. **/
+    template<typename Type,
+             typename Allocator = Allocator<Type>>
+    class TombstoneDVector
+    {
+        using object_type = Type;
+        using size_type = size_t;
+        using word_type = uint64_t;
+
+        static constexpr size_type wordBits { std::numeric_limits<word_type>::digits };
+
+    private:
+        DVector<object_type, Allocator> storage;
+
+        /** Bit per slot, set for the erased ones: **/
+        DVector<bool> erased;
+
+        size_type deadCount { 0 };
+
+        /** Compaction runs when more than this part of the slots are dead: **/
+        double maxDeadRatio { 0.25 };
+
+    private:
+
+        /** First live slot not before 'slot', Slots() if there is none: **/
+        [[nodiscard]]
+        size_type nextLive(size_type slot) const noexcept
+        {
+            const size_type slots = storage.Size();
+            for (; slot < slots; slot += wordBits)
+                if (const word_type live = ~erased.BitsAt(slot); 0 != live)
+                    return std::min(slot + static_cast<size_type>(std::countr_zero(live)), slots);
+            return slots;
+        }
+
+        /** Moves the run of 'count' live elements down from 'from' to 'to': **/
+        void moveRun(const size_type from, const size_type count, const size_type to)
+        {
+            if (from == to)
+                return;
+            if constexpr (std::is_trivially_copyable_v<object_type>)
+                std::memmove(storage.Data() + to, storage.Data() + from, count * sizeof(object_type));
+            else
+                std::move(storage.Data() + from, storage.Data() + from + count, storage.Data() + to);
+        }
+
+    public:
+
+        class iterator
+        {
+            const TombstoneDVector* owner { nullptr };
+            size_type slot { 0 };
+
+        public:
+
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = object_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = object_type*;
+            using reference = object_type&;
+
+            iterator() = default;
+
+            iterator(const TombstoneDVector* vector, size_type position) noexcept:
+                    owner { vector }, slot { position } {
+            }
+
+            [[nodiscard]]
+            reference operator*() const noexcept {
+                return owner->storage[slot];
+            }
+
+            [[nodiscard]]
+            pointer operator->() const noexcept {
+                return &owner->storage[slot];
+            }
+
+            /** Slot of the element, to be passed to lazy_erase(): **/
+            [[nodiscard]]
+            size_type Slot() const noexcept {
+                return slot;
+            }
+
+            iterator& operator++() noexcept
+            {
+                slot = owner->nextLive(slot + 1);
+                return *this;
+            }
+
+            iterator operator++(int) noexcept
+            {
+                iterator previous = *this;
+                ++*this;
+                return previous;
+            }
+
+            [[nodiscard]]
+            friend bool operator==(const iterator& first, const iterator& second) noexcept {
+                return first.slot == second.slot;
+            }
+        };
+
+    public:
+
+        explicit TombstoneDVector(const size_type capacity = 0, const double deadRatio = 0.25):
+                storage (capacity), erased (capacity), maxDeadRatio { deadRatio } {
+        }
+
+        /** Number of the live elements: **/
+        [[nodiscard]]
+        inline size_type Size() const noexcept {
+            return storage.Size() - deadCount;
+        }
+
+        [[nodiscard]]
+        inline bool Empty() const noexcept {
+            return 0 == Size();
+        }
+
+        /** Number of the slots, the tombstones included: **/
+        [[nodiscard]]
+        inline size_type Slots() const noexcept {
+            return storage.Size();
+        }
+
+        [[nodiscard]]
+        inline size_type DeadCount() const noexcept {
+            return deadCount;
+        }
+
+        [[nodiscard]]
+        object_type& operator[] (size_type slot) const noexcept {
+            return storage[slot];
+        }
+
+        [[nodiscard]]
+        bool IsErased(size_type slot) const noexcept {
+            return erased[slot];
+        }
+
+        [[nodiscard]]
+        iterator begin() const noexcept {
+            return iterator { this, nextLive(0) };
+        }
+
+        [[nodiscard]]
+        iterator end() const noexcept {
+            return iterator { this, storage.Size() };
+        }
+
+        template<typename ... Args>
+        object_type& emplace_back(Args&&... params)
+        {
+            object_type& value = storage.emplace_back(std::forward<Args>(params)...);
+            erased.push_back(false);
+            return value;
+        }
+
+        template<typename ... Args>
+        object_type& emplace_front(Args&&... params)
+        {
+            object_type& value = storage.emplace_front(std::forward<Args>(params)...);
+            erased.push_front(false);
+            return value;
+        }
+
+        object_type& push_back(const object_type& v) {
+            return emplace_back(v);
+        }
+
+        object_type& push_back(object_type&& v) {
+            return emplace_back(std::move(v));
+        }
+
+        object_type& push_front(const object_type& v) {
+            return emplace_front(v);
+        }
+
+        object_type& push_front(object_type&& v) {
+            return emplace_front(std::move(v));
+        }
+
+        /** Marks the slot erased, the trailing tombstones are dropped right away. Returns true if
+         *  the compaction ran, so the slot indices held by the caller are no longer valid: **/
+        bool lazy_erase(const size_type slot)
+        {
+            if (slot >= storage.Size())
+                throw std::out_of_range(std::format("{} slot is out of range", slot));
+            if (erased[slot])
+                return false;
+
+            erased[slot] = true;
+            ++deadCount;
+            while (!storage.Empty() && erased.Back()) {
+                storage.pop_back();
+                erased.pop_back();
+                --deadCount;
+            }
+
+            if (static_cast<double>(deadCount) <= maxDeadRatio * static_cast<double>(storage.Size()))
+                return false;
+            Compact();
+            return true;
+        }
+
+        /** Removes all the tombstones in one pass: the bitmap is scanned word by word and every run
+         *  of the live elements is moved down at once (memmove for the trivially copyable types): **/
+        void Compact()
+        {
+            if (0 == deadCount)
+                return;
+
+            const size_type slots = storage.Size();
+            size_type write = 0;
+            for (size_type base = 0; base < slots; base += wordBits)
+            {
+                const size_type count = std::min(wordBits, slots - base);
+                word_type live = ~erased.BitsAt(base);
+                if (count < wordBits)
+                    live &= (word_type { 1 } << count) - 1;
+
+                while (0 != live)
+                {
+                    const int start = std::countr_zero(live);
+                    const int length = std::countr_one(live >> start);
+                    moveRun(base + start, length, write);
+                    write += length;
+                    live = wordBits == static_cast<size_type>(start + length) ? 0 : live & (~word_type { 0 } << (start + length));
+                }
+            }
+
+            storage.pop_back(slots - write);
+            erased.Clear();
+            for (size_type idx = 0; idx < write; ++idx)
+                erased.push_back(false);
+            deadCount = 0;
+        }
+
+        void Clear() noexcept
+        {
+            storage.Clear();
+            erased.Clear();
+            deadCount = 0;
+        }
+
+        template<typename Callback>
+        void forEach(Callback&& callback) const
+        {
+            for (object_type& value: *this)
+                callback(value);
+        }
+    };
+}
+
+#endif //CPPPROJECTS_TOMBSTONEDVECTOR_H
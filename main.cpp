@@ -16,11 +16,37 @@ Description : DVector.cpp
 #include <deque>
 
 #include "DVector.h"
+#include "SharedDVector.h"
+#include "ConcurrentReadDVector.h"
+#include "FlatMap.h"
+#include "SlidingWindow.h"
+#include "CompressedDVector.h"
+#include "SequencedDVector.h"
+#include "DVectorIO.h"
+#include "FrameBuilder.h"
+#include "AsyncChannel.h"
+#include "RecyclingAllocator.h"
+#include "TieredDVector.h"
+#include "HandleDVector.h"
+#include "DVectorTrace.h"
+#include "StringDVector.h"
+#include "GapDVector.h"
+#include "TombstoneDVector.h"
+#include "ShmDVector.h"
+#include "DVectorSort.h"
 
 /** For testing only: **/
 #include <chrono>
 #include <unordered_set>
+#include <set>
+#include <map>
+#include <numeric>
+#include <cstdint>
 #include <random>
+#include <thread>
+#include <atomic>
+#include <sstream>
+#include <sys/wait.h>
 
 #include <boost/test/unit_test.hpp>
 
@@ -91,6 +117,110 @@ namespace Utilities
     }
 }
 
+/** Allocator and element type counting the performance relevant operations: **/
+namespace Instrumentation
+{
+    struct AllocationStats
+    {
+        static inline size_t allocations { 0 };
+        static inline size_t deallocations { 0 };
+        static inline size_t bytesAllocated { 0 };
+
+        static void reset() noexcept {
+            allocations = deallocations = bytesAllocated = 0;
+        }
+    };
+
+    template<typename Ty>
+    struct CountingAllocator: DVector::Allocator<Ty>
+    {
+        template<typename Other>
+        struct rebind {
+            using other = CountingAllocator<Other>;
+        };
+
+        Ty* allocate(size_t size)
+        {
+            ++AllocationStats::allocations;
+            AllocationStats::bytesAllocated += size * sizeof(Ty);
+            return DVector::Allocator<Ty>::allocate(size);
+        }
+
+        void deallocate(Ty* ptr, size_t size)
+        {
+            ++AllocationStats::deallocations;
+            DVector::Allocator<Ty>::deallocate(ptr, size);
+        }
+    };
+
+    struct Tracked
+    {
+        static inline size_t constructions { 0 };
+        static inline size_t copies { 0 };
+        static inline size_t moves { 0 };
+        static inline size_t destructions { 0 };
+
+        int value { 0 };
+
+        static void reset() noexcept {
+            constructions = copies = moves = destructions = 0;
+        }
+
+        /** Number of the objects currently alive: **/
+        static size_t alive() noexcept {
+            return constructions + copies + moves - destructions;
+        }
+
+        Tracked() noexcept {
+            ++constructions;
+        }
+
+        Tracked(int v) noexcept: value { v } {
+            ++constructions;
+        }
+
+        Tracked(const Tracked& other) noexcept: value { other.value } {
+            ++copies;
+        }
+
+        Tracked(Tracked&& other) noexcept: value { other.value } {
+            ++moves;
+        }
+
+        Tracked& operator=(const Tracked& other) noexcept {
+            value = other.value;
+            ++copies;
+            return *this;
+        }
+
+        Tracked& operator=(Tracked&& other) noexcept {
+            value = other.value;
+            ++moves;
+            return *this;
+        }
+
+        ~Tracked() {
+            ++destructions;
+        }
+    };
+
+    using TrackedVector = DVector::DVector<Tracked, CountingAllocator<Tracked>>;
+
+    void reset() noexcept {
+        AllocationStats::reset();
+        Tracked::reset();
+    }
+
+    /** Smallest k for which initialCapacity * 4^k holds the 'size' elements pushed to one side: **/
+    size_t expectedGrowths(size_t size)
+    {
+        size_t growths = 0;
+        for (size_t capacity = 10; capacity - capacity / 2 < size; capacity *= 4)
+            ++growths;
+        return growths;
+    }
+}
+
 
 
 /**    **/
@@ -962,3 +1092,2775 @@ BOOST_AUTO_TEST_SUITE(DataMethodTests)
     }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+
+/**  SharedDVector tests  **/
+BOOST_AUTO_TEST_SUITE(SharedDVectorTests)
+
+    BOOST_AUTO_TEST_CASE(Copy_SharesStorage)
+    {
+        const std::deque<int> testValues = Utilities::getRandomIntegerDeque(50);
+        DVector::SharedDVector<int> original;
+        for (int v: testValues)
+            original.push_back(v);
+
+        const DVector::SharedDVector<int> snapshot (original);
+
+        BOOST_CHECK_EQUAL(2, original.UseCount());
+        BOOST_CHECK_EQUAL(original.Data(), snapshot.Data());
+        Utilities::assertContent(testValues, snapshot.Storage());
+    }
+
+    BOOST_AUTO_TEST_CASE(Mutation_DetachesStorage)
+    {
+        const std::deque<int> testValues = Utilities::getRandomIntegerDeque(50);
+        DVector::SharedDVector<int> original;
+        for (int v: testValues)
+            original.push_back(v);
+
+        const DVector::SharedDVector<int> snapshot (original);
+        original.push_front(-1);
+        original.push_back(-2);
+
+        BOOST_CHECK_EQUAL(1, original.UseCount());
+        BOOST_CHECK_EQUAL(1, snapshot.UseCount());
+        BOOST_CHECK_NE(original.Data(), snapshot.Data());
+        BOOST_CHECK_EQUAL(testValues.size() + 2, original.Size());
+        BOOST_CHECK_EQUAL(-1, original.Front());
+        BOOST_CHECK_EQUAL(-2, original.Back());
+        Utilities::assertContent(testValues, snapshot.Storage());
+    }
+
+    BOOST_AUTO_TEST_CASE(Mutation_UniqueOwner_NoCopy)
+    {
+        DVector::SharedDVector<int> vector;
+        vector.push_back(1);
+        const int* data = vector.Data();
+
+        vector.Mutable(0) = 2;
+
+        BOOST_CHECK_EQUAL(data, vector.Data());
+        BOOST_CHECK_EQUAL(2, vector[0]);
+    }
+
+    BOOST_AUTO_TEST_CASE(Clear_KeepsSnapshot)
+    {
+        const std::deque<int> testValues = Utilities::getRandomIntegerDeque(20);
+        DVector::SharedDVector<int> original;
+        for (int v: testValues)
+            original.push_back(v);
+
+        const DVector::SharedDVector<int> snapshot (original);
+        original.Clear();
+
+        BOOST_CHECK_EQUAL(true, original.Empty());
+        Utilities::assertContent(testValues, snapshot.Storage());
+    }
+
+    BOOST_AUTO_TEST_CASE(EscapedReference_DoesNotLeakIntoSnapshot)
+    {
+        DVector::SharedDVector<int> vector;
+        vector.push_back(1);
+        vector.push_back(2);
+
+        int& first = vector.Mutable(0);
+        const DVector::SharedDVector<int> snapshot (vector);
+        first = 42;
+
+        BOOST_CHECK_EQUAL(1, snapshot[0]);
+        BOOST_CHECK_EQUAL(42, vector[0]);
+        BOOST_CHECK_EQUAL(1, snapshot.UseCount());
+        BOOST_CHECK_NE(vector.Data(), snapshot.Data());
+    }
+
+    BOOST_AUTO_TEST_CASE(Set_DetachesSharedStorage)
+    {
+        DVector::SharedDVector<int> vector;
+        vector.push_back(1);
+        const DVector::SharedDVector<int> snapshot (vector);
+        BOOST_CHECK(vector.IsShared());
+
+        vector.Set(0, 5);
+        BOOST_CHECK_EQUAL(5, vector[0]);
+        BOOST_CHECK_EQUAL(1, snapshot[0]);
+        BOOST_CHECK(!vector.IsShared());
+
+        /** Set() does not let the reference escape, the copies stay O(1): **/
+        const DVector::SharedDVector<int> second (vector);
+        BOOST_CHECK_EQUAL(vector.Data(), second.Data());
+    }
+
+    BOOST_AUTO_TEST_CASE(MovedFrom_StaysUsable)
+    {
+        DVector::SharedDVector<int> vector;
+        vector.push_back(1);
+        vector.push_back(2);
+
+        DVector::SharedDVector<int> target (std::move(vector));
+        BOOST_CHECK_EQUAL(2UL, target.Size());
+        BOOST_CHECK(vector.Empty());
+        BOOST_CHECK_EQUAL(0UL, vector.Size());
+        vector.Clear();
+
+        /** Moved-from instances share the empty storage until one of them is mutated: **/
+        DVector::SharedDVector<int> other (std::move(target));
+        BOOST_CHECK(target.Empty());
+        vector.push_back(3);
+        target.push_front(4);
+        BOOST_CHECK_EQUAL(3, vector.Front());
+        BOOST_CHECK_EQUAL(4, target.Front());
+        BOOST_CHECK_EQUAL(1UL, vector.Size());
+
+        const DVector::SharedDVector<int> snapshot (vector);
+        other = std::move(vector);
+        BOOST_CHECK(vector.Empty());
+        vector.push_back(5);
+        BOOST_CHECK_EQUAL(5, vector.Back());
+        BOOST_CHECK_EQUAL(3, other.Front());
+        BOOST_CHECK_EQUAL(3, snapshot.Front());
+    }
+
+    BOOST_AUTO_TEST_CASE(Snapshots_DroppedByOtherThreads)
+    {
+        DVector::SharedDVector<int> vector;
+        for (int idx = 0; idx < 1'000; ++idx)
+            vector.push_back(idx);
+
+        std::atomic<int> mismatches { 0 };
+        for (int round = 0; round < 100; ++round)
+        {
+            std::thread reader([snapshot = DVector::SharedDVector<int>(vector), &mismatches] {
+                if (0 != snapshot[0])
+                    ++mismatches;
+            });
+            vector.Set(0, round + 1);
+            vector.Set(0, 0);
+            reader.join();
+        }
+        BOOST_CHECK_EQUAL(0, mismatches.load());
+        BOOST_CHECK_EQUAL(1, vector.UseCount());
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+/**  ConcurrentReadDVector tests  **/
+BOOST_AUTO_TEST_SUITE(ConcurrentReadDVectorTests)
+
+    BOOST_AUTO_TEST_CASE(TinyCapacity_ClampedToTwo)
+    {
+        for (const size_t capacity: { 1UL, 2UL }) {
+            DVector::ConcurrentReadDVector<int> vector (capacity);
+            vector.push_front(1);
+            vector.push_back(2);
+            vector.push_front(0);
+            const auto snapshot = vector.Read();
+            BOOST_REQUIRE_EQUAL(3UL, snapshot.Size());
+            BOOST_CHECK_EQUAL(0, snapshot[0]);
+            BOOST_CHECK_EQUAL(2, snapshot[2]);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(PushBothSides_ReadSnapshot)
+    {
+        DVector::ConcurrentReadDVector<int> vector;
+        for (int i = 1; i <= 50; ++i) {
+            vector.push_back(i);
+            vector.push_front(-i);
+        }
+
+        const auto snapshot = vector.Read();
+        BOOST_CHECK_EQUAL(100UL, snapshot.Size());
+        for (size_t idx = 0; idx < snapshot.Size(); ++idx)
+            BOOST_CHECK_EQUAL(idx < 50 ? static_cast<int>(idx) - 50 : static_cast<int>(idx) - 49, snapshot[idx]);
+    }
+
+    BOOST_AUTO_TEST_CASE(Snapshot_PinsRetiredBlock)
+    {
+        DVector::ConcurrentReadDVector<int> vector;
+        for (int i = 0; i < 5; ++i)
+            vector.push_back(i);
+
+        {
+            const auto snapshot = vector.Read();
+            for (int i = 5; i < 100; ++i)
+                vector.push_back(i);
+
+            BOOST_CHECK_LT(0UL, vector.RetiredCount());
+            BOOST_CHECK_EQUAL(5UL, snapshot.Size());
+            for (size_t idx = 0; idx < snapshot.Size(); ++idx)
+                BOOST_CHECK_EQUAL(static_cast<int>(idx), snapshot[idx]);
+        }
+
+        vector.Reclaim();
+        BOOST_CHECK_EQUAL(0UL, vector.RetiredCount());
+        BOOST_CHECK_EQUAL(100UL, vector.Size());
+    }
+
+    BOOST_AUTO_TEST_CASE(ConcurrentReaders_SingleWriter)
+    {
+        constexpr int count { 100'000 };
+        DVector::ConcurrentReadDVector<int> vector;
+        vector.push_back(0);
+
+        std::atomic<bool> done { false };
+        std::atomic<size_t> errors { 0 };
+
+        std::vector<std::thread> readers;
+        for (int i = 0; i < 4; ++i)
+            readers.emplace_back([&] {
+                while (!done.load(std::memory_order_acquire)) {
+                    const auto snapshot = vector.Read();
+                    const int front = snapshot.Front(), back = snapshot.Back();
+                    if (front > 0 || back < 0 || static_cast<size_t>(back - front + 1) != snapshot.Size())
+                        errors.fetch_add(1);
+                    for (size_t idx = 1; idx < snapshot.Size(); ++idx)
+                        if (snapshot[idx] != snapshot[idx - 1] + 1)
+                            errors.fetch_add(1);
+                }
+            });
+
+        for (int i = 1; i <= count; ++i) {
+            vector.push_back(i);
+            vector.push_front(-i);
+        }
+        done.store(true, std::memory_order_release);
+        for (std::thread& reader: readers)
+            reader.join();
+
+        BOOST_CHECK_EQUAL(0UL, errors.load());
+        BOOST_CHECK_EQUAL(2UL * count + 1, vector.Size());
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+/**  Range population tests  **/
+BOOST_AUTO_TEST_SUITE(RangePopulationTests)
+
+    BOOST_AUTO_TEST_CASE(AppendFrom_SizedRange_PresizeExactly)
+    {
+        DVector::DVector<int> dVector;
+        dVector.push_back(-1);
+        dVector.append_from(std::views::iota(0, 100));
+
+        BOOST_CHECK_EQUAL(101UL, dVector.Size());
+        BOOST_CHECK_EQUAL(0UL, dVector.BackCapacity());
+        for (size_t idx = 0; idx < dVector.Size(); ++idx)
+            BOOST_CHECK_EQUAL(static_cast<int>(idx) - 1, dVector[idx]);
+    }
+
+    BOOST_AUTO_TEST_CASE(PrependFrom_SizedRange_KeepsOrder)
+    {
+        const std::deque<int> testValues = Utilities::getRandomIntegerDeque(50);
+        DVector::DVector<int> dVector;
+        dVector.push_back(-1);
+        dVector.prepend_from(testValues);
+
+        std::deque<int> expected { testValues };
+        expected.push_back(-1);
+        Utilities::assertContent(expected, dVector);
+    }
+
+    BOOST_AUTO_TEST_CASE(AppendFrom_InputRange)
+    {
+        std::istringstream stream { "1 2 3 4 5 6 7 8 9 10 11 12 13 14 15" };
+        DVector::DVector<int> dVector;
+        dVector.append_from(std::views::istream<int>(stream));
+
+        BOOST_CHECK_EQUAL(15UL, dVector.Size());
+        for (size_t idx = 0; idx < dVector.Size(); ++idx)
+            BOOST_CHECK_EQUAL(static_cast<int>(idx) + 1, dVector[idx]);
+    }
+
+    BOOST_AUTO_TEST_CASE(PrependFrom_InputRange_KeepsOrder)
+    {
+        std::istringstream stream { "1 2 3 4 5 6 7 8 9 10 11 12 13 14 15" };
+        DVector::DVector<int> dVector;
+        dVector.push_back(16);
+        dVector.prepend_from(std::views::istream<int>(stream));
+
+        BOOST_CHECK_EQUAL(16UL, dVector.Size());
+        for (size_t idx = 0; idx < dVector.Size(); ++idx)
+            BOOST_CHECK_EQUAL(static_cast<int>(idx) + 1, dVector[idx]);
+    }
+
+    BOOST_AUTO_TEST_CASE(Reserve_BothSides)
+    {
+        DVector::DVector<int> dVector;
+        dVector.push_back(1);
+        dVector.Reserve(100, 200);
+
+        BOOST_CHECK_LE(100UL, dVector.FrontCapacity() - 1);
+        BOOST_CHECK_LE(200UL, dVector.BackCapacity());
+        BOOST_CHECK_EQUAL(1, dVector.Front());
+    }
+
+#if defined(__cpp_lib_containers_ranges)
+    BOOST_AUTO_TEST_CASE(FromRange_Constructor)
+    {
+        const DVector::DVector<int> dVector (std::from_range, std::views::iota(0, 100));
+        BOOST_CHECK_EQUAL(100UL, dVector.Size());
+        for (size_t idx = 0; idx < dVector.Size(); ++idx)
+            BOOST_CHECK_EQUAL(static_cast<int>(idx), dVector[idx]);
+    }
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+/**  Insert / erase in the middle tests  **/
+BOOST_AUTO_TEST_SUITE(InsertEraseTests)
+
+    BOOST_AUTO_TEST_CASE(Insert_AllPositions)
+    {
+        for (size_t position = 0; position <= 20; ++position)
+        {
+            std::deque<int> testValues = Utilities::getRandomIntegerDeque(20);
+            DVector::DVector<int> dVector;
+            for (int v: testValues)
+                dVector.push_back(v);
+
+            dVector.insert(position, -1);
+            testValues.insert(testValues.begin() + static_cast<std::ptrdiff_t>(position), -1);
+            Utilities::assertContent(testValues, dVector);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(Erase_AllPositions)
+    {
+        for (size_t position = 0; position < 20; ++position)
+        {
+            std::deque<int> testValues = Utilities::getRandomIntegerDeque(20);
+            DVector::DVector<int> dVector;
+            for (int v: testValues)
+                dVector.push_back(v);
+
+            dVector.erase(position);
+            testValues.erase(testValues.begin() + static_cast<std::ptrdiff_t>(position));
+            Utilities::assertContent(testValues, dVector);
+        }
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+/**  FlatSet / FlatMap tests  **/
+BOOST_AUTO_TEST_SUITE(FlatMapTests)
+
+    BOOST_AUTO_TEST_CASE(FlatSet_RandomInsert_Sorted)
+    {
+        const std::deque<int> testValues = Utilities::getRandomIntegerDeque(500);
+        DVector::FlatSet<int> flatSet;
+        std::set<int> expected;
+        for (int v: testValues)
+            BOOST_CHECK_EQUAL(expected.insert(v).second, flatSet.insert(v));
+
+        BOOST_CHECK_EQUAL(expected.size(), flatSet.Size());
+        BOOST_CHECK(std::equal(expected.begin(), expected.end(), flatSet.begin(), flatSet.end()));
+        for (int v: testValues)
+            BOOST_CHECK(flatSet.contains(v));
+        BOOST_CHECK(!flatSet.contains(-1));
+    }
+
+    BOOST_AUTO_TEST_CASE(FlatSet_Erase)
+    {
+        DVector::FlatSet<int> flatSet;
+        for (int v: {5, 1, 9, 3, 7})
+            flatSet.insert(v);
+
+        BOOST_CHECK(flatSet.erase(3));
+        BOOST_CHECK(!flatSet.erase(4));
+        BOOST_CHECK_EQUAL(4UL, flatSet.Size());
+        BOOST_CHECK(nullptr == flatSet.find(3));
+        BOOST_CHECK_EQUAL(5, *flatSet.find(5));
+    }
+
+    BOOST_AUTO_TEST_CASE(FlatSet_Merge)
+    {
+        DVector::FlatSet<int> flatSet;
+        for (int v: {10, 20, 30})
+            flatSet.insert(v);
+
+        flatSet.merge(std::vector<int> {40, 50, 50});
+        flatSet.merge(std::vector<int> {5, 15, 20, 25, 60});
+
+        const std::vector<int> expected {5, 10, 15, 20, 25, 30, 40, 50, 60};
+        BOOST_CHECK(std::equal(expected.begin(), expected.end(), flatSet.begin(), flatSet.end()));
+    }
+
+    BOOST_AUTO_TEST_CASE(FlatSet_Merge_Before_And_InputRange)
+    {
+        DVector::FlatSet<int> flatSet;
+        for (int v: {10, 20})
+            flatSet.insert(v);
+
+        flatSet.merge(std::vector<int> {1, 2, 2, 5});
+        BOOST_CHECK_EQUAL(5UL, flatSet.Size());
+
+        std::istringstream input { "3 4 15 30" };
+        flatSet.merge(std::views::istream<int>(input));
+
+        const std::vector<int> expected {1, 2, 3, 4, 5, 10, 15, 20, 30};
+        BOOST_CHECK(std::equal(expected.begin(), expected.end(), flatSet.begin(), flatSet.end()));
+    }
+
+    BOOST_AUTO_TEST_CASE(FlatMap_ConstLookup)
+    {
+        DVector::FlatMap<int, std::string> flatMap;
+        flatMap.insert(1, "one");
+        flatMap.find(1)->append("!");
+
+        const DVector::FlatMap<int, std::string>& view = flatMap;
+        static_assert(std::is_same_v<const std::string*, decltype(view.find(1))>);
+        static_assert(std::is_same_v<const std::string&, decltype(view.at(1))>);
+        BOOST_CHECK_EQUAL("one!", view.at(1));
+        BOOST_CHECK(nullptr == view.find(2));
+    }
+
+    BOOST_AUTO_TEST_CASE(FlatMap_InsertOrAssign_Subscript_NoCopies)
+    {
+        using Instrumentation::Tracked;
+        DVector::FlatMap<int, Tracked> flatMap (16);
+
+        Tracked::reset();
+        BOOST_CHECK(flatMap.insert_or_assign(1, Tracked { 10 }));
+        BOOST_CHECK(!flatMap.insert_or_assign(1, Tracked { 11 }));
+        BOOST_CHECK(flatMap.insert_or_assign(0, Tracked { 0 }));
+        BOOST_CHECK_EQUAL(0UL, Tracked::copies);
+        BOOST_CHECK_EQUAL(3UL, Tracked::constructions);
+        BOOST_CHECK_EQUAL(11, flatMap.at(1).value);
+
+        /** Existing key: nothing is constructed, a new one gets a single default value: **/
+        flatMap[1].value = 12;
+        BOOST_CHECK_EQUAL(3UL, Tracked::constructions);
+        BOOST_CHECK_EQUAL(0, flatMap[2].value);
+        BOOST_CHECK_EQUAL(4UL, Tracked::constructions);
+        BOOST_CHECK_EQUAL(0UL, Tracked::copies);
+        BOOST_CHECK_EQUAL(12, flatMap.at(1).value);
+    }
+
+    BOOST_AUTO_TEST_CASE(FlatMap_InsertFindErase)
+    {
+        const std::deque<int> testValues = Utilities::getRandomIntegerDeque(300);
+        DVector::FlatMap<int, std::string> flatMap;
+        std::map<int, std::string> expected;
+        for (int v: testValues) {
+            expected.insert_or_assign(v, std::to_string(v * 2));
+            flatMap.insert_or_assign(v, std::to_string(v * 2));
+        }
+
+        BOOST_CHECK_EQUAL(expected.size(), flatMap.Size());
+        for (const auto& [key, value]: expected)
+            BOOST_CHECK_EQUAL(value, flatMap.at(key));
+
+        flatMap[-5] = "minus five";
+        BOOST_CHECK_EQUAL("minus five", flatMap.begin()->second);
+        BOOST_CHECK(flatMap.erase(-5));
+        BOOST_CHECK(nullptr == flatMap.find(-5));
+        BOOST_REQUIRE_THROW([&]{ [[maybe_unused]] auto& x = flatMap.at(-5);}(), std::out_of_range);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+/**  Re-centering instead of the reallocation  **/
+BOOST_AUTO_TEST_SUITE(RecenterTests)
+
+    BOOST_AUTO_TEST_CASE(QueueUsage_NoGrowth)
+    {
+        DVector::DVector<int> dVector;
+        for (int i = 0; i < 3; ++i)
+            dVector.push_back(i);
+
+        for (int i = 3; i < 1000; ++i) {
+            dVector.push_back(i);
+            dVector.pop_front();
+        }
+
+        BOOST_CHECK_EQUAL(10UL, dVector.Capacity());
+        Utilities::assertContent(std::deque<int> {997, 998, 999}, dVector);
+    }
+
+    BOOST_AUTO_TEST_CASE(ReverseQueueUsage_NoGrowth)
+    {
+        DVector::DVector<int> dVector;
+        for (int i = 0; i < 3; ++i)
+            dVector.push_front(i);
+
+        for (int i = 3; i < 1000; ++i) {
+            dVector.push_front(i);
+            dVector.pop_back();
+        }
+
+        BOOST_CHECK_EQUAL(10UL, dVector.Capacity());
+        Utilities::assertContent(std::deque<int> {999, 998, 997}, dVector);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+/**  SlidingWindow tests  **/
+BOOST_AUTO_TEST_SUITE(SlidingWindowTests)
+
+    using namespace DVector::Aggregate;
+
+    BOOST_AUTO_TEST_CASE(MinMaxSumMean_MatchBruteForce)
+    {
+        constexpr size_t windowSize { 17 };
+        const std::deque<int> testValues = Utilities::getRandomIntegerDeque(500);
+        DVector::SlidingWindow<int, Min, Max, Sum, Mean> window (windowSize);
+
+        for (size_t idx = 0; idx < testValues.size(); ++idx)
+        {
+            window.push(testValues[idx]);
+
+            const auto first = testValues.begin() + static_cast<std::ptrdiff_t>(idx + 1 - std::min(idx + 1, windowSize));
+            const auto last = testValues.begin() + static_cast<std::ptrdiff_t>(idx + 1);
+            const int sum = std::accumulate(first, last, 0);
+
+            BOOST_CHECK_EQUAL(*std::min_element(first, last), window.Get<Min>());
+            BOOST_CHECK_EQUAL(*std::max_element(first, last), window.Get<Max>());
+            BOOST_CHECK_EQUAL(sum, window.Get<Sum>());
+            BOOST_CHECK_CLOSE(static_cast<double>(sum) / static_cast<double>(last - first), window.Get<Mean>(), 1e-9);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(Fold_NonCommutativeOperation)
+    {
+        DVector::SlidingWindow<std::string, Fold<std::plus<>>> window (3);
+        for (const char* value: {"a", "b", "c", "d", "e", "f", "g"})
+            window.push(value);
+
+        BOOST_CHECK_EQUAL("efg", window.Get<Fold<std::plus<>>>());
+        window.push("h");
+        BOOST_CHECK_EQUAL("fgh", window.Get<Fold<std::plus<>>>());
+    }
+
+    BOOST_AUTO_TEST_CASE(WarmedUp_NoReallocation)
+    {
+        DVector::SlidingWindow<double, Min, Max, Mean> window (100);
+        for (int i = 0; i < 1000; ++i)
+            window.push(i);
+
+        const size_t capacity = window.Values().Capacity();
+        for (int i = 0; i < 100'000; ++i)
+            window.push(i % 777);
+
+        BOOST_CHECK_EQUAL(capacity, window.Values().Capacity());
+        BOOST_CHECK_EQUAL(100UL, window.Size());
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+/**  Storage alignment tests  **/
+BOOST_AUTO_TEST_SUITE(AlignmentTests)
+
+    template<typename Vector>
+    bool isAligned(const Vector& vector, size_t alignment) {
+        return 0 == reinterpret_cast<std::uintptr_t>(vector.Data()) % alignment;
+    }
+
+    BOOST_AUTO_TEST_CASE(Aligned_AfterConstruction)
+    {
+        const DVector::AlignedDVector<float, 64> dVector;
+        BOOST_CHECK(isAligned(dVector, 64));
+        BOOST_CHECK_LE(32UL, dVector.Capacity());
+    }
+
+    BOOST_AUTO_TEST_CASE(Aligned_AfterGrowth)
+    {
+        DVector::AlignedDVector<float, 64> dVector;
+        size_t capacity = dVector.Capacity();
+        for (int i = 0; i < 10'000; ++i)
+        {
+            dVector.push_back(static_cast<float>(i));
+            if (dVector.Capacity() != capacity) {
+                capacity = dVector.Capacity();
+                BOOST_CHECK(isAligned(dVector, 64));
+            }
+        }
+        BOOST_CHECK_EQUAL(10'000UL, dVector.Size());
+        BOOST_CHECK_EQUAL(9'999.0f, dVector.Back());
+    }
+
+    BOOST_AUTO_TEST_CASE(Aligned_AfterRecenter)
+    {
+        DVector::AlignedDVector<double, 64> dVector;
+        size_t recenterCount = 0;
+        for (int i = 0; i < 1'000; ++i)
+        {
+            const double* data = dVector.Data();
+            dVector.push_back(i);
+            if (dVector.Data() < data) {
+                ++recenterCount;
+                BOOST_CHECK(isAligned(dVector, 64));
+            }
+            if (dVector.Size() > 3)
+                dVector.pop_front();
+        }
+        BOOST_CHECK_LT(0UL, recenterCount);
+    }
+
+    BOOST_AUTO_TEST_CASE(Aligned_AfterClear)
+    {
+        DVector::AlignedDVector<int, 32> dVector;
+        for (int i = 0; i < 100; ++i)
+            dVector.push_front(i);
+
+        dVector.Clear();
+        dVector.push_back(1);
+        BOOST_CHECK(isAligned(dVector, 32));
+    }
+
+    BOOST_AUTO_TEST_CASE(CacheLinePadded_Layout)
+    {
+        using Padded = DVector::CacheLinePadded<DVector::DVector<int>>;
+        BOOST_CHECK_EQUAL(0UL, sizeof(Padded) % 64);
+        BOOST_CHECK_EQUAL(64UL, alignof(Padded));
+
+        std::vector<Padded> perThread (4);
+        perThread[1].push_back(1);
+        BOOST_CHECK_EQUAL(1, perThread[1].Front());
+        BOOST_CHECK_EQUAL(64, reinterpret_cast<const char*>(&perThread[1]) - reinterpret_cast<const char*>(&perThread[0]));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+/**  Bit-packed DVector<bool> tests  **/
+BOOST_AUTO_TEST_SUITE(BoolDVectorTests)
+
+    void assertBits(const std::deque<bool>& expected, const DVector::DVector<bool>& bits)
+    {
+        BOOST_REQUIRE_EQUAL(expected.size(), bits.Size());
+        for (size_t idx = 0; idx < expected.size(); ++idx)
+            BOOST_CHECK_EQUAL(expected[idx], bits[idx]);
+    }
+
+    DVector::DVector<bool> makeBits(const std::deque<bool>& values, size_t frontCount)
+    {
+        DVector::DVector<bool> bits;
+        for (size_t idx = frontCount; idx < values.size(); ++idx)
+            bits.push_back(values[idx]);
+        for (size_t idx = frontCount; idx > 0; --idx)
+            bits.push_front(values[idx - 1]);
+        return bits;
+    }
+
+    std::deque<bool> randomBits(size_t size)
+    {
+        std::deque<bool> values;
+        for (size_t idx = 0; idx < size; ++idx)
+            values.push_back(1 == Utilities::getRandomIntInRange(0, 1));
+        return values;
+    }
+
+    BOOST_AUTO_TEST_CASE(PushBothSides)
+    {
+        const std::deque<bool> expected = randomBits(1000);
+        assertBits(expected, makeBits(expected, 333));
+    }
+
+    BOOST_AUTO_TEST_CASE(PopBothSides)
+    {
+        std::deque<bool> expected = randomBits(500);
+        DVector::DVector<bool> bits = makeBits(expected, 200);
+        while (!expected.empty())
+        {
+            BOOST_CHECK_EQUAL(expected.front(), bits.Front());
+            BOOST_CHECK_EQUAL(expected.back(), bits.Back());
+            if (expected.size() % 3) {
+                expected.pop_front();
+                bits.pop_front();
+            } else {
+                expected.pop_back();
+                bits.pop_back();
+            }
+            BOOST_CHECK_EQUAL(static_cast<size_t>(std::count(expected.begin(), expected.end(), true)), bits.PopCount());
+        }
+        BOOST_CHECK(bits.Empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(ProxyReference)
+    {
+        DVector::DVector<bool> bits;
+        for (int i = 0; i < 100; ++i)
+            bits.push_back(false);
+
+        bits[3] = true;
+        bits[64] = bits[3];
+        bits[65].flip();
+
+        BOOST_CHECK_EQUAL(3UL, bits.PopCount());
+        BOOST_CHECK_EQUAL(3UL, bits.FindFirstSet());
+        BOOST_CHECK(bits.at(64));
+        BOOST_REQUIRE_THROW([&]{ [[maybe_unused]] bool x = bits.at(100);}(), std::out_of_range);
+    }
+
+    BOOST_AUTO_TEST_CASE(FindFirstSet_WithFrontOffset)
+    {
+        DVector::DVector<bool> bits;
+        for (int i = 0; i < 200; ++i)
+            bits.push_front(false);
+        BOOST_CHECK_EQUAL(200UL, bits.FindFirstSet());
+
+        bits[150] = true;
+        bits[170] = true;
+        BOOST_CHECK_EQUAL(150UL, bits.FindFirstSet());
+    }
+
+    BOOST_AUTO_TEST_CASE(BitwiseOperations_DifferentOffsets)
+    {
+        const std::deque<bool> first = randomBits(777), second = randomBits(777);
+        const DVector::DVector<bool> firstBits = makeBits(first, 13), secondBits = makeBits(second, 100);
+
+        std::deque<bool> expectedAnd, expectedOr, expectedXor;
+        for (size_t idx = 0; idx < first.size(); ++idx) {
+            expectedAnd.push_back(first[idx] && second[idx]);
+            expectedOr.push_back(first[idx] || second[idx]);
+            expectedXor.push_back(first[idx] != second[idx]);
+        }
+
+        assertBits(expectedAnd, firstBits & secondBits);
+        assertBits(expectedOr, firstBits | secondBits);
+        assertBits(expectedXor, firstBits ^ secondBits);
+        assertBits(expectedOr, secondBits | firstBits);
+    }
+
+    BOOST_AUTO_TEST_CASE(BitwiseOperations_SizeMismatch)
+    {
+        DVector::DVector<bool> first = makeBits(randomBits(10), 0);
+        const DVector::DVector<bool> second = makeBits(randomBits(11), 0);
+        BOOST_REQUIRE_THROW(first &= second, std::invalid_argument);
+    }
+
+    BOOST_AUTO_TEST_CASE(Memory_OneBitPerElement)
+    {
+        DVector::DVector<bool> bits;
+        for (int i = 0; i < 64 * 1000; ++i)
+            bits.push_back(true);
+
+        BOOST_CHECK_EQUAL(1000UL, bits.Words().Size());
+        BOOST_CHECK_EQUAL(64UL * 1000, bits.PopCount());
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+/**  CompressedDVector tests  **/
+BOOST_AUTO_TEST_SUITE(CompressedDVectorTests)
+
+    BOOST_AUTO_TEST_CASE(PushBothSides_RandomAccess)
+    {
+        std::deque<int64_t> expected;
+        DVector::CompressedDVector<int64_t, 16> vector;
+        for (int i = 0; i < 1000; ++i)
+        {
+            const int64_t value = Utilities::getRandomIntInRange(-1'000'000, 1'000'000) * int64_t { 1'000'000 };
+            if (i % 3) {
+                expected.push_back(value);
+                vector.push_back(value);
+            } else {
+                expected.push_front(value);
+                vector.push_front(value);
+            }
+        }
+
+        BOOST_REQUIRE_EQUAL(expected.size(), vector.Size());
+        for (size_t idx = 0; idx < expected.size(); ++idx)
+            BOOST_CHECK_EQUAL(expected[idx], vector[idx]);
+        BOOST_REQUIRE_THROW([&]{ [[maybe_unused]] auto x = vector.at(1000);}(), std::out_of_range);
+    }
+
+    BOOST_AUTO_TEST_CASE(ExtremeDeltas)
+    {
+        const std::deque<int32_t> expected { std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max(),
+                                             0, -1, std::numeric_limits<int32_t>::max(), std::numeric_limits<int32_t>::min(), 7, 7 };
+        DVector::CompressedDVector<int32_t, 4> vector;
+        for (const int32_t value: expected)
+            vector.push_back(value);
+
+        for (size_t idx = 0; idx < expected.size(); ++idx)
+            BOOST_CHECK_EQUAL(expected[idx], vector[idx]);
+    }
+
+    BOOST_AUTO_TEST_CASE(Scan_MatchesContent)
+    {
+        DVector::CompressedDVector<uint64_t> vector;
+        std::deque<uint64_t> expected;
+        for (uint64_t i = 0; i < 5000; ++i) {
+            vector.push_back(i * 3);
+            expected.push_back(i * 3);
+            vector.push_front(1'000'000 - i);
+            expected.push_front(1'000'000 - i);
+        }
+
+        size_t index = 0;
+        vector.forEach([&](uint64_t value) { BOOST_CHECK_EQUAL(expected[index++], value); });
+        BOOST_CHECK_EQUAL(expected.size(), index);
+    }
+
+    BOOST_AUTO_TEST_CASE(MonotoneTimestamps_Compression)
+    {
+        constexpr size_t count { 1'000'000 };
+        DVector::CompressedDVector<int64_t> vector;
+        int64_t timestamp = 1'700'000'000'000'000;
+        for (size_t i = 0; i < count; ++i) {
+            timestamp += Utilities::getRandomIntInRange(0, 1000);
+            vector.push_back(timestamp);
+        }
+
+        vector.ShrinkToFit();
+
+        BOOST_CHECK_EQUAL(count, vector.Size());
+        BOOST_CHECK_LT(vector.MemoryUsage() * 4, count * sizeof(int64_t));
+        BOOST_CHECK_EQUAL(timestamp, vector[count - 1]);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+/**  ShrinkToFit() method tests  **/
+BOOST_AUTO_TEST_SUITE(ShrinkToFitTests)
+
+    BOOST_AUTO_TEST_CASE(ShrinkAndGrowAgain)
+    {
+        const std::deque<int> testValues = Utilities::getRandomIntegerDeque(100);
+        DVector::DVector<int> dVector;
+        for (int v: testValues)
+            dVector.push_back(v);
+
+        dVector.ShrinkToFit();
+        BOOST_CHECK_EQUAL(102UL, dVector.Capacity());
+        Utilities::assertContent(testValues, dVector);
+
+        std::deque<int> expected { testValues };
+        for (int i = 0; i < 10; ++i) {
+            dVector.push_front(-i);
+            dVector.push_back(i);
+            expected.push_front(-i);
+            expected.push_back(i);
+        }
+        Utilities::assertContent(expected, dVector);
+    }
+
+    BOOST_AUTO_TEST_CASE(Aligned_KeepsConstructorMinimum)
+    {
+        DVector::AlignedDVector<char, 64> dVector;
+        dVector.push_back('a');
+        dVector.ShrinkToFit();
+        BOOST_CHECK_LE(128UL, dVector.Capacity());
+
+        for (char c = 'b'; c <= 'z'; ++c)
+            dVector.push_back(c);
+        BOOST_CHECK_EQUAL(26UL, dVector.Size());
+        BOOST_CHECK_EQUAL('z', dVector.Back());
+        BOOST_CHECK_EQUAL(0UL, reinterpret_cast<std::uintptr_t>(dVector.Data()) % 64);
+    }
+
+    BOOST_AUTO_TEST_CASE(Aligned_QueueUsageAfterShrink)
+    {
+        DVector::AlignedDVector<char, 64> dVector;
+        dVector.ShrinkToFit();
+        for (int i = 0; i < 1'000; ++i)
+        {
+            dVector.push_back(static_cast<char>('a' + i % 26));
+            if (dVector.Size() > 1)
+                dVector.pop_front();
+            dVector.push_front('#');
+            dVector.pop_front();
+        }
+        BOOST_CHECK_EQUAL(1UL, dVector.Size());
+        BOOST_CHECK_EQUAL(static_cast<char>('a' + 999 % 26), dVector.Front());
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+/**  Performance regression tests: allocations, constructions, copies and moves  **/
+BOOST_AUTO_TEST_SUITE(AllocationCountTests)
+
+    using namespace Instrumentation;
+
+    BOOST_AUTO_TEST_CASE(Construction_DoesNotConstructCapacity)
+    {
+        reset();
+        {
+            const TrackedVector vector (1000);
+            BOOST_CHECK_EQUAL(1UL, AllocationStats::allocations);
+            BOOST_CHECK_EQUAL(0UL, Tracked::constructions);
+        }
+        BOOST_CHECK_EQUAL(1UL, AllocationStats::deallocations);
+        BOOST_CHECK_EQUAL(0UL, Tracked::destructions);
+    }
+
+    BOOST_AUTO_TEST_CASE(PushBack_LogarithmicAllocations)
+    {
+        for (const size_t count: {1UL, 5UL, 6UL, 100UL, 10'000UL, 100'000UL})
+        {
+            reset();
+            TrackedVector vector;
+            for (size_t i = 0; i < count; ++i)
+                vector.push_back(Tracked { static_cast<int>(i) });
+
+            BOOST_CHECK_EQUAL(1 + expectedGrowths(count), AllocationStats::allocations);
+            BOOST_CHECK_EQUAL(expectedGrowths(count), AllocationStats::deallocations);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(GrowVector_MovesEachElementOnce)
+    {
+        TrackedVector vector;
+        for (int i = 0; i < 5; ++i)
+            vector.emplace_back(i);
+
+        reset();
+        vector.emplace_back(5);
+
+        BOOST_CHECK_EQUAL(1UL, AllocationStats::allocations);
+        BOOST_CHECK_EQUAL(5UL, Tracked::moves);
+        BOOST_CHECK_EQUAL(0UL, Tracked::copies);
+        BOOST_CHECK_EQUAL(1UL, Tracked::constructions);
+        BOOST_CHECK_EQUAL(5UL, Tracked::destructions);
+    }
+
+    BOOST_AUTO_TEST_CASE(PushBack_RValue_OneMove)
+    {
+        TrackedVector vector;
+        Tracked value { 1 };
+
+        reset();
+        vector.push_back(std::move(value));
+        vector.push_front(value);
+
+        BOOST_CHECK_EQUAL(1UL, Tracked::moves);
+        BOOST_CHECK_EQUAL(1UL, Tracked::copies);
+        BOOST_CHECK_EQUAL(0UL, Tracked::constructions);
+        BOOST_CHECK_EQUAL(0UL, AllocationStats::allocations);
+    }
+
+    BOOST_AUTO_TEST_CASE(CopyConstructor_CopiesOnlyElements)
+    {
+        TrackedVector vector;
+        for (int i = 0; i < 50; ++i)
+            vector.emplace_front(i);
+
+        reset();
+        const TrackedVector copy (vector);
+
+        BOOST_CHECK_EQUAL(1UL, AllocationStats::allocations);
+        BOOST_CHECK_EQUAL(50UL, Tracked::copies);
+        BOOST_CHECK_EQUAL(0UL, Tracked::constructions);
+    }
+
+    BOOST_AUTO_TEST_CASE(MoveOperations_NoAllocations)
+    {
+        TrackedVector vector;
+        for (int i = 0; i < 50; ++i)
+            vector.emplace_back(i);
+
+        reset();
+        TrackedVector moved (std::move(vector));
+        TrackedVector assigned;
+        assigned = std::move(moved);
+
+        BOOST_CHECK_EQUAL(1UL, AllocationStats::allocations);
+        BOOST_CHECK_EQUAL(1UL, AllocationStats::deallocations);
+        BOOST_CHECK_EQUAL(0UL, Tracked::moves + Tracked::copies);
+    }
+
+    BOOST_AUTO_TEST_CASE(Destruction_EachElementOnce)
+    {
+        reset();
+        {
+            TrackedVector vector;
+            for (int i = 0; i < 100; ++i) {
+                vector.emplace_back(i);
+                vector.emplace_front(-i);
+            }
+            vector.pop_back();
+            vector.pop_front();
+            vector.Clear();
+            for (int i = 0; i < 10; ++i)
+                vector.emplace_back(i);
+        }
+        BOOST_CHECK_EQUAL(0UL, Tracked::alive());
+        BOOST_CHECK_EQUAL(AllocationStats::allocations, AllocationStats::deallocations);
+    }
+
+    BOOST_AUTO_TEST_CASE(Clear_KeepsStorage)
+    {
+        TrackedVector vector;
+        for (int i = 0; i < 100; ++i)
+            vector.emplace_back(i);
+
+        reset();
+        vector.Clear();
+        for (int i = 0; i < 20; ++i)
+            vector.emplace_back(i);
+
+        BOOST_CHECK_EQUAL(0UL, AllocationStats::allocations + AllocationStats::deallocations);
+        BOOST_CHECK_EQUAL(100UL, Tracked::destructions);
+    }
+
+    BOOST_AUTO_TEST_CASE(AppendFrom_SizedRange_SingleAllocation)
+    {
+        const std::vector<Tracked> values (1000);
+        TrackedVector vector;
+
+        reset();
+        vector.append_from(values);
+
+        BOOST_CHECK_EQUAL(1UL, AllocationStats::allocations);
+        BOOST_CHECK_EQUAL(1000UL, Tracked::copies);
+        BOOST_CHECK_EQUAL(0UL, Tracked::moves);
+    }
+
+    BOOST_AUTO_TEST_CASE(QueueUsage_NoAllocationsOnceWarmedUp)
+    {
+        TrackedVector vector;
+        for (int i = 0; i < 100; ++i)
+            vector.emplace_back(i);
+        for (int i = 0; i < 100; ++i)
+            vector.pop_front();
+        for (int i = 0; i < 3; ++i)
+            vector.emplace_back(i);
+
+        reset();
+        for (int i = 0; i < 10'000; ++i) {
+            vector.emplace_back(i);
+            vector.pop_front();
+        }
+
+        BOOST_CHECK_EQUAL(0UL, AllocationStats::allocations);
+        BOOST_CHECK_EQUAL(3UL, vector.Size());
+        BOOST_CHECK_LT(Tracked::moves, 10'000UL);
+    }
+
+    BOOST_AUTO_TEST_CASE(Insert_ShiftsShorterHalf)
+    {
+        TrackedVector vector (200);
+        for (int i = 0; i < 100; ++i)
+            vector.emplace_back(i);
+
+        reset();
+        vector.insert(10, Tracked { -1 });
+
+        /** One move into the parameter, one to the new front, 9 shifted and the final assignment: **/
+        BOOST_CHECK_EQUAL(0UL, AllocationStats::allocations);
+        BOOST_CHECK_GE(12UL, Tracked::moves);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+/**  SequencedDVector tests  **/
+BOOST_AUTO_TEST_SUITE(SequencedDVectorTests)
+
+    BOOST_AUTO_TEST_CASE(SequenceNumbers_StableAfterPopFront)
+    {
+        DVector::SequencedDVector<int> log (0);
+        for (int i = 0; i < 100; ++i)
+            BOOST_CHECK_EQUAL(static_cast<uint64_t>(i), log.push_back(i * 10));
+
+        for (int i = 0; i < 30; ++i)
+            log.pop_front();
+
+        BOOST_CHECK_EQUAL(30UL, log.front_seq());
+        BOOST_CHECK_EQUAL(99UL, log.back_seq());
+        BOOST_CHECK_EQUAL(100UL, log.next_seq());
+        for (uint64_t sequence = 30; sequence < 100; ++sequence)
+            BOOST_CHECK_EQUAL(static_cast<int>(sequence) * 10, log.at_seq(sequence));
+
+        BOOST_CHECK(!log.contains_seq(29));
+        BOOST_REQUIRE_THROW([&]{ [[maybe_unused]] auto& x = log.at_seq(29);}(), std::out_of_range);
+        BOOST_REQUIRE_THROW([&]{ [[maybe_unused]] auto& x = log.at_seq(100);}(), std::out_of_range);
+    }
+
+    BOOST_AUTO_TEST_CASE(PushFront_TakesPreviousNumber)
+    {
+        DVector::SequencedDVector<std::string> log (1000);
+        BOOST_CHECK_EQUAL(1000UL, log.push_back("b"));
+        BOOST_CHECK_EQUAL(999UL, log.push_front("a"));
+        BOOST_CHECK_EQUAL(1001UL, log.push_back("c"));
+
+        BOOST_CHECK_EQUAL("a", log.at_seq(999));
+        BOOST_CHECK_EQUAL("c", log.at_seq(1001));
+
+        DVector::SequencedDVector<int> zeroBased (0);
+        BOOST_REQUIRE_THROW(zeroBased.push_front(1), std::out_of_range);
+    }
+
+    BOOST_AUTO_TEST_CASE(PopFrontUntil_Cursor)
+    {
+        DVector::SequencedDVector<int> log (0);
+        for (int i = 0; i < 50; ++i)
+            log.push_back(i);
+
+        const uint64_t cursor = 20;
+        BOOST_CHECK_EQUAL(20UL, log.pop_front_until(cursor));
+        BOOST_CHECK_EQUAL(0UL, log.pop_front_until(cursor));
+        BOOST_CHECK_EQUAL(20, log.Front());
+        BOOST_CHECK_EQUAL(20, log.at_seq(cursor));
+
+        BOOST_CHECK_EQUAL(30UL, log.pop_front_until(1000));
+        BOOST_CHECK(log.Empty());
+        BOOST_CHECK_EQUAL(50UL, log.front_seq());
+        BOOST_CHECK_EQUAL(50UL, log.push_back(50));
+    }
+
+    BOOST_AUTO_TEST_CASE(Clear_KeepsNumbering)
+    {
+        DVector::SequencedDVector<int> log (0);
+        for (int i = 0; i < 10; ++i)
+            log.push_back(i);
+
+        log.Clear();
+        BOOST_CHECK_EQUAL(10UL, log.push_back(10));
+    }
+
+    BOOST_AUTO_TEST_CASE(Default_PushFrontAndBack)
+    {
+        using Log = DVector::SequencedDVector<int>;
+        Log log;
+        BOOST_CHECK_EQUAL(Log::middleSequence, log.push_back(1));
+        BOOST_CHECK_EQUAL(Log::middleSequence - 1, log.push_front(0));
+        BOOST_CHECK_EQUAL(Log::middleSequence + 1, log.push_back(2));
+
+        BOOST_CHECK_EQUAL(Log::middleSequence - 1, log.front_seq());
+        BOOST_CHECK_EQUAL(0, log.at_seq(Log::middleSequence - 1));
+        BOOST_CHECK_EQUAL(2, log.at_seq(log.back_seq()));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+/**  Bulk pop / resize tests  **/
+BOOST_AUTO_TEST_SUITE(BulkPopResizeTests)
+
+    BOOST_AUTO_TEST_CASE(PopFront_PopBack_Count)
+    {
+        std::deque<int> testValues = Utilities::getRandomIntegerDeque(100);
+        DVector::DVector<int> dVector;
+        for (int v: testValues)
+            dVector.push_back(v);
+
+        dVector.pop_front(30);
+        dVector.pop_back(20);
+        testValues.erase(testValues.begin(), testValues.begin() + 30);
+        testValues.erase(testValues.end() - 20, testValues.end());
+
+        Utilities::assertContent(testValues, dVector);
+        dVector.pop_front(50);
+        BOOST_CHECK(dVector.Empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(PopCount_DestroysElements)
+    {
+        using namespace Instrumentation;
+        TrackedVector vector;
+        for (int i = 0; i < 100; ++i)
+            vector.emplace_back(i);
+
+        reset();
+        vector.pop_front(10);
+        vector.pop_back(15);
+
+        BOOST_CHECK_EQUAL(25UL, Tracked::destructions);
+        BOOST_CHECK_EQUAL(10, vector.Front().value);
+        BOOST_CHECK_EQUAL(84, vector.Back().value);
+    }
+
+    BOOST_AUTO_TEST_CASE(ResizeBack_ValueInit)
+    {
+        DVector::DVector<int> dVector;
+        dVector.push_back(7);
+        dVector.resize_back(100);
+
+        BOOST_CHECK_EQUAL(100UL, dVector.Size());
+        BOOST_CHECK_EQUAL(7, dVector.Front());
+        for (size_t idx = 1; idx < dVector.Size(); ++idx)
+            BOOST_CHECK_EQUAL(0, dVector[idx]);
+
+        dVector.resize_back(3);
+        BOOST_CHECK_EQUAL(3UL, dVector.Size());
+        BOOST_CHECK_EQUAL(7, dVector.Front());
+    }
+
+    BOOST_AUTO_TEST_CASE(ResizeFront_ValueInit)
+    {
+        DVector::DVector<std::string> dVector;
+        dVector.push_back("last");
+        dVector.resize_front(50);
+
+        BOOST_CHECK_EQUAL(50UL, dVector.Size());
+        BOOST_CHECK_EQUAL("last", dVector.Back());
+        BOOST_CHECK_EQUAL("", dVector.Front());
+
+        dVector.resize_front(1);
+        BOOST_CHECK_EQUAL(1UL, dVector.Size());
+        BOOST_CHECK_EQUAL("last", dVector.Front());
+    }
+
+    BOOST_AUTO_TEST_CASE(Resize_DefaultInit_BulkFill)
+    {
+        DVector::DVector<int> dVector;
+        dVector.push_back(0);
+        dVector.resize_back(1001, DVector::default_init);
+        std::iota(dVector.begin(), dVector.end(), 0);
+
+        dVector.resize_front(2001, DVector::default_init);
+        std::iota(dVector.begin(), dVector.begin() + 1000, -1000);
+
+        BOOST_CHECK_EQUAL(2001UL, dVector.Size());
+        for (size_t idx = 0; idx < dVector.Size(); ++idx)
+            BOOST_CHECK_EQUAL(static_cast<int>(idx) - 1000, dVector[idx]);
+    }
+
+    BOOST_AUTO_TEST_CASE(ResizeBack_DefaultInit_CallsDefaultCtor)
+    {
+        using namespace Instrumentation;
+        TrackedVector vector;
+
+        reset();
+        vector.resize_back(500, DVector::default_init);
+        BOOST_CHECK_EQUAL(500UL, Tracked::constructions);
+        BOOST_CHECK_EQUAL(1UL, AllocationStats::allocations);
+
+        /** With the user-provided default constructor the value-initialization does the same: **/
+        vector.resize_back(1000);
+        BOOST_CHECK_EQUAL(1000UL, Tracked::constructions);
+        BOOST_CHECK_EQUAL(0UL, Tracked::copies);
+    }
+
+    BOOST_AUTO_TEST_CASE(Resize_DefaultInit_LeavesTrivialSlotsUntouched)
+    {
+        constexpr unsigned char pattern { 0x5A };
+        DVector::DVector<unsigned char> dVector (1000);
+        for (int i = 0; i < 100; ++i)
+            dVector.push_back(pattern);
+        const unsigned char* slots = dVector.Data();
+        dVector.pop_back(100);
+
+        /** Default-initialization writes nothing, the value-initialization zeroes the slots: **/
+        dVector.resize_back(100, DVector::default_init);
+        BOOST_REQUIRE(slots == dVector.Data());
+        BOOST_CHECK_EQUAL(100, std::ranges::count(dVector, pattern));
+
+        dVector.pop_back(100);
+        dVector.resize_back(100);
+        BOOST_CHECK_EQUAL(100, std::ranges::count(dVector, 0));
+    }
+
+    BOOST_AUTO_TEST_CASE(ResizeLoop_LogarithmicAllocations)
+    {
+        using namespace Instrumentation;
+        DVector::DVector<int, CountingAllocator<int>> back, front;
+
+        AllocationStats::reset();
+        constexpr size_t steps { 10'000 };
+        for (size_t i = 0; i < steps; ++i) {
+            back.resize_back(back.Size() + 16, DVector::default_init);
+            front.resize_front(front.Size() + 16);
+        }
+
+        BOOST_CHECK_EQUAL(16 * steps, back.Size());
+        BOOST_CHECK_EQUAL(16 * steps, front.Size());
+        BOOST_CHECK_GE(2 * 12UL, AllocationStats::allocations);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+/**  Prepare / commit and file descriptor I/O tests  **/
+BOOST_AUTO_TEST_SUITE(DVectorIOTests)
+
+    struct Pipe
+    {
+        int fds[2] { -1, -1 };
+
+        Pipe() {
+            BOOST_REQUIRE_EQUAL(0, ::pipe(fds));
+        }
+
+        ~Pipe() {
+            ::close(fds[0]);
+            ::close(fds[1]);
+        }
+
+        void send(std::string_view text) const {
+            BOOST_REQUIRE_EQUAL(static_cast<ssize_t>(text.size()), ::write(fds[1], text.data(), text.size()));
+        }
+
+        [[nodiscard]]
+        std::string receive(size_t count) const {
+            std::string text(count, '\0');
+            BOOST_REQUIRE_EQUAL(static_cast<ssize_t>(count), ::read(fds[0], text.data(), count));
+            return text;
+        }
+    };
+
+    [[nodiscard]]
+    std::string toString(const DVector::DVector<char>& vector) {
+        return { vector.begin(), vector.end() };
+    }
+
+    BOOST_AUTO_TEST_CASE(PrepareCommit_Back)
+    {
+        DVector::DVector<int> dVector;
+        dVector.push_back(1);
+
+        const std::span<int> slots = dVector.prepare_back(100);
+        BOOST_CHECK_EQUAL(100UL, slots.size());
+        BOOST_CHECK_LE(100UL, dVector.BackCapacity());
+        std::iota(slots.begin(), slots.end(), 2);
+        dVector.commit_back(50);
+
+        BOOST_CHECK_EQUAL(51UL, dVector.Size());
+        for (size_t idx = 0; idx < dVector.Size(); ++idx)
+            BOOST_CHECK_EQUAL(static_cast<int>(idx) + 1, dVector[idx]);
+    }
+
+    BOOST_AUTO_TEST_CASE(PrepareCommit_Front)
+    {
+        DVector::DVector<int> dVector;
+        dVector.push_back(100);
+
+        const std::span<int> slots = dVector.prepare_front(99);
+        std::iota(slots.begin(), slots.end(), 1);
+        dVector.commit_front(99);
+        dVector.push_front(0);
+
+        BOOST_CHECK_EQUAL(101UL, dVector.Size());
+        for (size_t idx = 0; idx < dVector.Size(); ++idx)
+            BOOST_CHECK_EQUAL(static_cast<int>(idx), dVector[idx]);
+    }
+
+    BOOST_AUTO_TEST_CASE(PrepareCommit_NoReallocation_WithinHeadroom)
+    {
+        DVector::DVector<char> dVector (1024);
+        const void* buffer = dVector.prepare_back(100).data();
+        dVector.commit_back(100);
+        BOOST_CHECK(buffer == dVector.Data());
+    }
+
+    BOOST_AUTO_TEST_CASE(Read_Back_And_Front)
+    {
+        const Pipe pipe;
+        DVector::DVector<char> dVector;
+        dVector.push_back('|');
+
+        pipe.send("payload");
+        BOOST_CHECK_EQUAL(7, DVector::IO::read(pipe.fds[0], dVector, 64));
+        pipe.send("header");
+        BOOST_CHECK_EQUAL(6, DVector::IO::read_front(pipe.fds[0], dVector, 64));
+
+        BOOST_CHECK_EQUAL("header|payload", toString(dVector));
+    }
+
+    BOOST_AUTO_TEST_CASE(Readv_Scatters_InOrder)
+    {
+        const Pipe pipe;
+        DVector::DVector<char> header, body;
+        body.push_back('>');
+
+        pipe.send("HEADbody-bytes");
+        const std::array<DVector::IO::ReadTarget<char>, 2> targets {{ { &header, 4 }, { &body, 64 } }};
+        BOOST_CHECK_EQUAL(14, DVector::IO::readv(pipe.fds[0], targets));
+
+        BOOST_CHECK_EQUAL("HEAD", toString(header));
+        BOOST_CHECK_EQUAL(">body-bytes", toString(body));
+    }
+
+    BOOST_AUTO_TEST_CASE(Readv_DuplicateTarget_Rejected)
+    {
+        const Pipe pipe;
+        DVector::DVector<char> body;
+
+        pipe.send("body");
+        const std::array<DVector::IO::ReadTarget<char>, 2> targets {{ { &body, 2 }, { &body, 2 } }};
+        BOOST_CHECK_EQUAL(-1, DVector::IO::readv(pipe.fds[0], targets));
+        BOOST_CHECK_EQUAL(EINVAL, errno);
+        BOOST_CHECK(body.Empty());
+        BOOST_CHECK_EQUAL("body", pipe.receive(4));
+    }
+
+    BOOST_AUTO_TEST_CASE(Writev_DuplicateSource_Rejected)
+    {
+        const Pipe pipe;
+        DVector::DVector<char> body;
+        for (char c: std::string_view("body"))
+            body.push_back(c);
+
+        const std::array<DVector::DVector<char>*, 2> sources { &body, &body };
+        BOOST_CHECK_EQUAL(-1, DVector::IO::writev(pipe.fds[1], sources));
+        BOOST_CHECK_EQUAL(EINVAL, errno);
+        BOOST_CHECK_EQUAL("body", toString(body));
+
+        pipe.send("!");
+        BOOST_CHECK_EQUAL("!", pipe.receive(1));
+    }
+
+    BOOST_AUTO_TEST_CASE(ReadLoop_LogarithmicAllocations)
+    {
+        using namespace Instrumentation;
+        const Pipe pipe;
+        DVector::DVector<char, CountingAllocator<char>> back, front;
+
+        AllocationStats::reset();
+        constexpr size_t reads { 10'000 };
+        for (size_t i = 0; i < reads; ++i) {
+            pipe.send("0123456789abcdef");
+            BOOST_REQUIRE_EQUAL(16, DVector::IO::read(pipe.fds[0], back, 16));
+            pipe.send("0123456789abcdef");
+            BOOST_REQUIRE_EQUAL(16, DVector::IO::read_front(pipe.fds[0], front, 16));
+        }
+
+        BOOST_CHECK_EQUAL(16 * reads, back.Size());
+        BOOST_CHECK_EQUAL(16 * reads, front.Size());
+        BOOST_CHECK_GE(2 * 12UL, AllocationStats::allocations);
+    }
+
+    BOOST_AUTO_TEST_CASE(Write_Writev_Consume)
+    {
+        const Pipe pipe;
+        DVector::DVector<char> first, second;
+        for (char c: std::string_view("first,"))
+            first.push_back(c);
+        for (char c: std::string_view("second"))
+            second.push_back(c);
+
+        const std::array<DVector::DVector<char>*, 2> sources { &first, &second };
+        BOOST_CHECK_EQUAL(12, DVector::IO::writev(pipe.fds[1], sources));
+        BOOST_CHECK(first.Empty() && second.Empty());
+        BOOST_CHECK_EQUAL("first,second", pipe.receive(12));
+
+        for (char c: std::string_view("tail"))
+            first.push_back(c);
+        BOOST_CHECK_EQUAL(4, DVector::IO::write(pipe.fds[1], first));
+        BOOST_CHECK(first.Empty());
+        BOOST_CHECK_EQUAL("tail", pipe.receive(4));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+/**  FrameBuilder tests  **/
+BOOST_AUTO_TEST_SUITE(FrameBuilderTests)
+
+    [[nodiscard]]
+    std::vector<uint8_t> toBytes(std::span<const std::byte> frame) {
+        std::vector<uint8_t> bytes;
+        for (const std::byte b: frame)
+            bytes.push_back(std::to_integer<uint8_t>(b));
+        return bytes;
+    }
+
+    [[nodiscard]]
+    std::vector<std::byte> makePayload(std::string_view text) {
+        std::vector<std::byte> payload;
+        for (const char c: text)
+            payload.push_back(static_cast<std::byte>(c));
+        return payload;
+    }
+
+    BOOST_AUTO_TEST_CASE(PrependBigEndian)
+    {
+        DVector::FrameBuilder builder;
+        builder.append(makePayload("ab"));
+        builder.prepend_be<uint16_t>(0x0102);
+        builder.prepend_be<uint32_t>(0xA0B0C0D0);
+
+        const std::vector<uint8_t> expected { 0xA0, 0xB0, 0xC0, 0xD0, 0x01, 0x02, 'a', 'b' };
+        const std::vector<uint8_t> actual = toBytes(builder.Frame());
+        BOOST_CHECK_EQUAL_COLLECTIONS(expected.begin(), expected.end(), actual.begin(), actual.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(Varints)
+    {
+        DVector::FrameBuilder builder;
+        builder.append_varint(300);
+        builder.prepend_varint(1);
+        builder.prepend_varint(0);
+        builder.append_varint(127);
+
+        const std::vector<uint8_t> expected { 0x00, 0x01, 0xAC, 0x02, 0x7F };
+        const std::vector<uint8_t> actual = toBytes(builder.Frame());
+        BOOST_CHECK_EQUAL_COLLECTIONS(expected.begin(), expected.end(), actual.begin(), actual.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(NestedEncapsulation_NoPayloadCopy)
+    {
+        DVector::FrameBuilder builder (64, 1024);
+        const std::vector<std::byte> payload = makePayload(std::string(1000, 'x'));
+        builder.append(payload);
+        const std::byte* payloadAddress = builder.Frame().data();
+
+        builder.prepend_be<uint8_t>(0x17);            // record type
+        builder.prepend_length_be<uint16_t>();         // record length
+        builder.prepend_length_varint();               // framing
+        builder.prepend_be<uint32_t>(0xCAFEBABE);     // transport tag
+
+        const std::span<const std::byte> frame = std::as_const(builder).Frame();
+        BOOST_CHECK_EQUAL(1000UL + 1 + 2 + 2 + 4, frame.size());
+        BOOST_CHECK(payloadAddress == frame.data() + 9);
+
+        const std::vector<uint8_t> header = toBytes(frame.first(9));
+        const std::vector<uint8_t> expected { 0xCA, 0xFE, 0xBA, 0xBE, 0xEB, 0x07, 0x03, 0xE9, 0x17 };
+        BOOST_CHECK_EQUAL_COLLECTIONS(expected.begin(), expected.end(), header.begin(), header.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(Headroom_Exhausted_StillCorrect)
+    {
+        DVector::FrameBuilder builder (4);
+        BOOST_CHECK_LE(4UL, builder.Headroom());
+        builder.append(makePayload("data"));
+
+        const std::vector<std::byte> header = makePayload(std::string(100, 'h'));
+        builder.prepend(header);
+
+        BOOST_CHECK_EQUAL(104UL, builder.Size());
+        BOOST_CHECK('h' == std::to_integer<char>(builder.Frame()[99]));
+        BOOST_CHECK('d' == std::to_integer<char>(builder.Frame()[100]));
+    }
+
+    BOOST_AUTO_TEST_CASE(Clear_RestoresHeadroom)
+    {
+        DVector::FrameBuilder builder (32);
+        builder.append(makePayload("abc"));
+        builder.prepend(makePayload(std::string(30, 'h')));
+
+        builder.Clear();
+        BOOST_CHECK_EQUAL(0UL, builder.Size());
+        BOOST_CHECK_LE(32UL, builder.Headroom());
+    }
+
+    BOOST_AUTO_TEST_CASE(AppendPrependLoop_LogarithmicReallocations)
+    {
+        DVector::FrameBuilder builder (8);
+        const std::byte* data = builder.Frame().data();
+        size_t reallocations = 0;
+        constexpr size_t iterations { 100'000 };
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            builder.append_be(static_cast<uint32_t>(i));
+            builder.prepend_be(static_cast<uint16_t>(i));
+            if (builder.Frame().data() + 2 != data)
+                ++reallocations;
+            data = builder.Frame().data();
+        }
+
+        BOOST_CHECK_EQUAL(6 * iterations, builder.Size());
+        BOOST_CHECK_GE(2 * 12UL, reallocations);
+        const std::vector<uint8_t> edges = toBytes(builder.Frame().first(2));
+        const std::vector<uint8_t> expected { 0x86, 0x9F };    // 99'999 truncated to 16 bits
+        BOOST_CHECK_EQUAL_COLLECTIONS(expected.begin(), expected.end(), edges.begin(), edges.end());
+        BOOST_CHECK(0x9F == std::to_integer<int>(builder.Frame().back()));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+/**  AsyncChannel tests  **/
+BOOST_AUTO_TEST_SUITE(AsyncChannelTests)
+
+    using DVector::AsyncChannel;
+    using DVector::Task;
+
+    Task produce(AsyncChannel<int>& channel, int first, int count, std::atomic<int>& sent)
+    {
+        for (int value = first; value < first + count; ++value)
+            if (co_await channel.send(value))
+                sent.fetch_add(1);
+    }
+
+    Task consume(AsyncChannel<int>& channel, std::vector<int>& received)
+    {
+        while (std::optional<int> value = co_await channel.receive())
+            received.push_back(*value);
+    }
+
+    Task consumeMany(AsyncChannel<int>& channel, size_t batchSize, std::vector<size_t>& batches, std::atomic<long>& sum)
+    {
+        std::vector<int> buffer(batchSize);
+        while (const size_t count = co_await channel.receive_many(buffer)) {
+            batches.push_back(count);
+            sum.fetch_add(std::accumulate(buffer.begin(), buffer.begin() + static_cast<long>(count), 0L));
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(SendReceive_Order)
+    {
+        DVector::SingleThreadExecutor executor;
+        AsyncChannel<int> channel { executor };
+        std::atomic<int> sent { 0 };
+        std::vector<int> received;
+
+        Task consumer = consume(channel, received);
+        Task producer = produce(channel, 0, 100, sent);
+        consumer.Start(executor);
+        producer.Start(executor);
+        executor.run();
+
+        BOOST_CHECK(producer.Done());
+        BOOST_CHECK(!consumer.Done());
+        channel.Close();
+        executor.run();
+        BOOST_CHECK(consumer.Done());
+
+        BOOST_REQUIRE_EQUAL(100UL, received.size());
+        for (int idx = 0; idx < 100; ++idx)
+            BOOST_CHECK_EQUAL(idx, received[idx]);
+    }
+
+    BOOST_AUTO_TEST_CASE(ReceiveMany_DrainsQueued)
+    {
+        DVector::SingleThreadExecutor executor;
+        AsyncChannel<int> channel { executor };
+        std::atomic<int> sent { 0 };
+        std::atomic<long> sum { 0 };
+        std::vector<size_t> batches;
+
+        Task producer = produce(channel, 1, 10, sent);
+        producer.Start(executor);
+        executor.run();
+        BOOST_CHECK_EQUAL(10UL, channel.Size());
+
+        Task consumer = consumeMany(channel, 4, batches, sum);
+        consumer.Start(executor);
+        BOOST_CHECK_EQUAL(1UL, executor.run());
+        channel.Close();
+        executor.run();
+
+        const std::vector<size_t> expected { 4, 4, 2 };
+        BOOST_CHECK_EQUAL_COLLECTIONS(expected.begin(), expected.end(), batches.begin(), batches.end());
+        BOOST_CHECK_EQUAL(55, sum.load());
+    }
+
+    BOOST_AUTO_TEST_CASE(Bounded_Backpressure)
+    {
+        DVector::SingleThreadExecutor executor;
+        AsyncChannel<int> channel { executor, 2 };
+        std::atomic<int> sent { 0 };
+        std::vector<int> received;
+
+        Task producer = produce(channel, 0, 5, sent);
+        producer.Start(executor);
+        executor.run();
+
+        BOOST_CHECK(!producer.Done());
+        BOOST_CHECK_EQUAL(2UL, channel.Size());
+        BOOST_CHECK_EQUAL(2, sent.load());
+
+        Task consumer = consume(channel, received);
+        consumer.Start(executor);
+        executor.run();
+
+        BOOST_CHECK(producer.Done());
+        BOOST_CHECK_EQUAL(5, sent.load());
+        BOOST_CHECK_EQUAL(5UL, received.size());
+
+        channel.Close();
+        executor.run();
+        BOOST_CHECK(consumer.Done());
+    }
+
+    BOOST_AUTO_TEST_CASE(Close_WakesSenders)
+    {
+        DVector::SingleThreadExecutor executor;
+        AsyncChannel<int> channel { executor, 1 };
+        std::atomic<int> sent { 0 };
+
+        Task producer = produce(channel, 0, 3, sent);
+        producer.Start(executor);
+        executor.run();
+        BOOST_CHECK(!producer.Done());
+
+        channel.Close();
+        executor.run();
+        BOOST_CHECK(producer.Done());
+        BOOST_CHECK_EQUAL(1, sent.load());
+    }
+
+    BOOST_AUTO_TEST_CASE(ThreadPool_ManyProducers_ManyConsumers)
+    {
+        constexpr int producersCount = 4, itemsPerProducer = 5'000;
+        std::atomic<int> sent { 0 };
+        std::atomic<long> sum { 0 };
+        std::vector<size_t> batches[2];
+        {
+            DVector::ThreadPoolExecutor executor { 4 };
+            AsyncChannel<int> channel { executor, 64 };
+
+            std::vector<Task> consumers, producers;
+            for (auto& consumerBatches: batches)
+                consumers.push_back(consumeMany(channel, 16, consumerBatches, sum));
+            for (int idx = 0; idx < producersCount; ++idx)
+                producers.push_back(produce(channel, idx * itemsPerProducer, itemsPerProducer, sent));
+
+            for (Task& task: consumers)
+                task.Start(executor);
+            for (Task& task: producers)
+                task.Start(executor);
+
+            for (const Task& task: producers)
+                while (!task.Done())
+                    std::this_thread::yield();
+            channel.Close();
+            for (const Task& task: consumers)
+                while (!task.Done())
+                    std::this_thread::yield();
+        }
+
+        constexpr long total = producersCount * itemsPerProducer;
+        BOOST_CHECK_EQUAL(total, sent.load());
+        BOOST_CHECK_EQUAL(total * (total - 1) / 2, sum.load());
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+/**  RecyclingAllocator tests  **/
+BOOST_AUTO_TEST_SUITE(RecyclingAllocatorTests)
+
+    /** Separate instantiations keep the counters and the free lists of the tests apart: **/
+    template<size_t Tag, size_t MaxCached = 16, size_t MaxDepot = 64>
+    using TestAllocator = DVector::RecyclingAllocator<int, alignof(int) << Tag, 8, MaxCached, MaxDepot>;
+
+    BOOST_AUTO_TEST_CASE(ShortLivedVectors_ReuseBuffers)
+    {
+        using Alloc = TestAllocator<0>;
+        Alloc::ResetStats();
+
+        for (int round = 0; round < 100; ++round)
+        {
+            DVector::DVector<int, Alloc> dVector;
+            for (int idx = 0; idx < 1000; ++idx)
+                dVector.push_back(idx);
+            BOOST_CHECK_EQUAL(999, dVector.Back());
+        }
+
+        const DVector::RecyclingStats& stats = Alloc::Stats();
+        BOOST_CHECK_EQUAL(5UL, stats.misses);
+        BOOST_CHECK_EQUAL(99UL * 5, stats.hits);
+        BOOST_CHECK_GT(stats.HitRate(), 0.98);
+    }
+
+    BOOST_AUTO_TEST_CASE(CapacityRoundedUp_ToClass)
+    {
+        using Alloc = TestAllocator<1>;
+        Alloc::ResetStats();
+
+        { DVector::DVector<int, Alloc> dVector (30); }
+        { DVector::DVector<int, Alloc> dVector (40); }
+        { DVector::DVector<int, Alloc> dVector (11); }
+
+        BOOST_CHECK_EQUAL(1UL, Alloc::Stats().misses);
+        BOOST_CHECK_EQUAL(2UL, Alloc::Stats().hits);
+    }
+
+    BOOST_AUTO_TEST_CASE(Limits_ReleaseToUpstream)
+    {
+        using Alloc = TestAllocator<2, 2, 1>;
+        Alloc::ResetStats();
+        {
+            std::vector<DVector::DVector<int, Alloc>> vectors(5);
+        }
+        BOOST_CHECK_EQUAL(5UL, Alloc::Stats().misses);
+        BOOST_CHECK_EQUAL(2UL, Alloc::Stats().released);
+
+        {
+            DVector::DVector<int, Alloc> huge (10 * 4 * 4 * 4 * 4 * 4 * 4 * 4 + 1);
+        }
+        BOOST_CHECK_EQUAL(3UL, Alloc::Stats().released);
+    }
+
+    BOOST_AUTO_TEST_CASE(CrossThread_ReturnThroughDepot)
+    {
+        using Alloc = TestAllocator<3, 1>;
+        Alloc::ResetStats();
+
+        std::vector<DVector::DVector<int, Alloc>> vectors(8);
+        for (auto& vector: vectors)
+            vector.push_back(42);
+
+        /** Freed by the other thread: one buffer stays in its cache, moved to the depot on exit: **/
+        std::thread { [moved = std::move(vectors)]() mutable { moved.clear(); } }.join();
+
+        std::vector<DVector::DVector<int, Alloc>> reused(8);
+        BOOST_CHECK_EQUAL(8UL, Alloc::Stats().misses);
+        BOOST_CHECK_EQUAL(8UL, Alloc::Stats().depotHits);
+        BOOST_CHECK_EQUAL(8UL, Alloc::Stats().hits);
+    }
+
+    BOOST_AUTO_TEST_CASE(Trim_MovesCacheToDepot)
+    {
+        using Alloc = TestAllocator<4>;
+        { DVector::DVector<int, Alloc> dVector; }
+        Alloc::Trim();
+        Alloc::ResetStats();
+
+        { DVector::DVector<int, Alloc> dVector; }
+        BOOST_CHECK_EQUAL(1UL, Alloc::Stats().depotHits);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+/**  Narrow SizeType tests  **/
+BOOST_AUTO_TEST_SUITE(SizeTypeTests)
+
+    template<typename Type, typename SizeType>
+    using NarrowDVector = DVector::DVector<Type, DVector::Allocator<Type>, SizeType>;
+
+    BOOST_AUTO_TEST_CASE(HeaderSize)
+    {
+        BOOST_CHECK_EQUAL(sizeof(void*) + 3 * sizeof(size_t), sizeof(DVector::DVector<int>));
+        BOOST_CHECK_EQUAL(sizeof(void*) + 3 * sizeof(uint32_t) + 4, sizeof(NarrowDVector<int, uint32_t>));
+        BOOST_CHECK_EQUAL(16UL, sizeof(NarrowDVector<int, uint16_t>));
+    }
+
+    BOOST_AUTO_TEST_CASE(NarrowIndices_BehaveTheSame)
+    {
+        std::deque<int> expected;
+        NarrowDVector<int, uint16_t> dVector;
+        for (int idx = 0; idx < 5000; ++idx) {
+            if (idx % 3) {
+                dVector.push_back(idx);
+                expected.push_back(idx);
+            } else {
+                dVector.push_front(idx);
+                expected.push_front(idx);
+            }
+        }
+        dVector.erase(100);
+        expected.erase(expected.begin() + 100);
+        dVector.insert(4000, -1);
+        expected.insert(expected.begin() + 4000, -1);
+
+        BOOST_REQUIRE_EQUAL(expected.size(), dVector.Size());
+        for (size_t idx = 0; idx < expected.size(); ++idx)
+            BOOST_CHECK_EQUAL(expected[idx], dVector[idx]);
+    }
+
+    BOOST_AUTO_TEST_CASE(Growth_Overflow_Throws)
+    {
+        NarrowDVector<uint8_t, uint16_t> dVector;
+        size_t pushed = 0;
+        BOOST_CHECK_THROW(while (true) { dVector.push_back(static_cast<uint8_t>(pushed)); ++pushed; }, std::length_error);
+
+        BOOST_CHECK_EQUAL(pushed, dVector.Size());
+        BOOST_CHECK_GT(pushed, 30'000UL);
+        BOOST_CHECK_EQUAL(std::numeric_limits<uint16_t>::max(), dVector.Capacity());
+        BOOST_CHECK_EQUAL(static_cast<uint8_t>(pushed - 1), dVector.Back());
+    }
+
+    BOOST_AUTO_TEST_CASE(Reserve_Overflow_Throws)
+    {
+        NarrowDVector<int, uint16_t> dVector;
+        dVector.push_back(1);
+        BOOST_CHECK_THROW(dVector.Reserve(0, 70'000), std::length_error);
+        BOOST_CHECK_THROW(dVector.Reserve(40'000, 40'000), std::length_error);
+        BOOST_CHECK_THROW((NarrowDVector<int, uint16_t>(100'000)), std::length_error);
+
+        BOOST_CHECK_EQUAL(1UL, dVector.Size());
+        BOOST_CHECK_EQUAL(1, dVector.Front());
+    }
+
+    BOOST_AUTO_TEST_CASE(NarrowBoolVector)
+    {
+        DVector::DVector<bool, DVector::Allocator<bool>, uint32_t> bits;
+        for (int idx = 0; idx < 1000; ++idx)
+            bits.push_back(0 == idx % 7);
+        BOOST_CHECK_EQUAL(143UL, bits.PopCount());
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+/**  TieredDVector tests  **/
+BOOST_AUTO_TEST_SUITE(TieredDVectorTests)
+
+    template<typename Type, size_t BlockSize>
+    void assertTiered(const std::deque<Type>& expected, const DVector::TieredDVector<Type, BlockSize>& vector)
+    {
+        BOOST_REQUIRE_EQUAL(expected.size(), vector.Size());
+        for (size_t idx = 0; idx < expected.size(); ++idx)
+            BOOST_CHECK_EQUAL(expected[idx], vector[idx]);
+    }
+
+    BOOST_AUTO_TEST_CASE(PushBothEnds_Indexing)
+    {
+        std::deque<int> expected;
+        DVector::TieredDVector<int, 8> vector;
+        for (int idx = 0; idx < 100; ++idx) {
+            vector.push_back(idx);
+            vector.push_front(-idx);
+            expected.push_back(idx);
+            expected.push_front(-idx);
+        }
+
+        assertTiered(expected, vector);
+        BOOST_CHECK_EQUAL(-99, vector.Front());
+        BOOST_CHECK_EQUAL(99, vector.Back());
+        BOOST_CHECK_LE(vector.BlockCount(), 200UL / 8 + 2);
+        BOOST_CHECK_THROW(static_cast<void>(vector.at(200)), std::out_of_range);
+    }
+
+    BOOST_AUTO_TEST_CASE(RandomEdits_MatchDeque)
+    {
+        std::mt19937 generator { 42 };
+        std::deque<std::string> expected;
+        DVector::TieredDVector<std::string, 4> vector;
+
+        for (int step = 0; step < 5000; ++step)
+        {
+            const size_t index = expected.empty() ? 0 : generator() % (expected.size() + 1);
+            switch (generator() % 6)
+            {
+                case 0: case 1: case 2:
+                    vector.insert(index, std::to_string(step));
+                    expected.insert(expected.begin() + static_cast<long>(index), std::to_string(step));
+                    break;
+                case 3:
+                    if (index < expected.size()) {
+                        vector.erase(index);
+                        expected.erase(expected.begin() + static_cast<long>(index));
+                    }
+                    break;
+                case 4:
+                    if (!expected.empty()) {
+                        vector.pop_front();
+                        expected.pop_front();
+                    }
+                    break;
+                default:
+                    if (!expected.empty()) {
+                        vector.pop_back();
+                        expected.pop_back();
+                    }
+            }
+        }
+        assertTiered(expected, vector);
+
+        while (!expected.empty()) {
+            vector.erase(expected.size() / 2);
+            expected.erase(expected.begin() + static_cast<long>(expected.size() / 2));
+        }
+        BOOST_CHECK(vector.Empty());
+        BOOST_CHECK_EQUAL(0UL, vector.BlockCount());
+    }
+
+    BOOST_AUTO_TEST_CASE(SpanIteration)
+    {
+        DVector::TieredDVector<int, 16> vector;
+        for (int idx = 0; idx < 100; ++idx)
+            vector.push_back(idx);
+        for (int idx = 1; idx <= 10; ++idx)
+            vector.push_front(-idx);
+        vector.insert(50, 1000);
+
+        std::vector<int> collected;
+        size_t spans = 0;
+        vector.forEachSpan([&](std::span<int> part) {
+            ++spans;
+            BOOST_CHECK_LE(part.size(), 16UL);
+            collected.insert(collected.end(), part.begin(), part.end());
+        });
+
+        BOOST_REQUIRE_EQUAL(vector.Size(), collected.size());
+        BOOST_CHECK_GE(spans, vector.BlockCount());
+        BOOST_CHECK_LE(spans, 2 * vector.BlockCount());
+        for (size_t idx = 0; idx < collected.size(); ++idx)
+            BOOST_CHECK_EQUAL(vector[idx], collected[idx]);
+
+        long sum = 0;
+        vector.forEach([&sum](int value) { sum += value; });
+        BOOST_CHECK_EQUAL(99 * 100 / 2 - 55 + 1000, sum);
+    }
+
+    BOOST_AUTO_TEST_CASE(ElementsDestroyed)
+    {
+        const auto token = std::make_shared<int>(0);
+        {
+            DVector::TieredDVector<std::shared_ptr<int>, 8> vector;
+            for (size_t idx = 0; idx < 100; ++idx)
+                vector.insert(idx / 2, token);
+            for (int idx = 0; idx < 30; ++idx)
+                vector.erase(10);
+            BOOST_CHECK_EQUAL(71L, token.use_count());
+        }
+        BOOST_CHECK_EQUAL(1L, token.use_count());
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+/**  HandleDVector tests  **/
+BOOST_AUTO_TEST_SUITE(HandleDVectorTests)
+
+    BOOST_AUTO_TEST_CASE(Handles_SurviveGrowth_And_PushFront)
+    {
+        DVector::HandleDVector<std::string> vector;
+        std::vector<DVector::Handle> handles;
+        for (int idx = 0; idx < 1000; ++idx)
+            handles.push_back(vector.push_back(std::to_string(idx)));
+        for (int idx = 1; idx <= 1000; ++idx)
+            vector.push_front(std::to_string(-idx));
+
+        for (int idx = 0; idx < 1000; ++idx) {
+            BOOST_CHECK_EQUAL(std::to_string(idx), vector.at(handles[idx]));
+            BOOST_CHECK_EQUAL(1000UL + idx, vector.IndexOf(handles[idx]));
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(Popped_Handles_AreStale)
+    {
+        DVector::HandleDVector<int> vector;
+        const DVector::Handle first = vector.push_back(1);
+        const DVector::Handle second = vector.push_back(2);
+        const DVector::Handle front = vector.push_front(0);
+
+        vector.pop_front();
+        vector.pop_back();
+        BOOST_CHECK(!vector.contains(front));
+        BOOST_CHECK(!vector.contains(second));
+        BOOST_CHECK(nullptr == vector.get(second));
+        BOOST_CHECK_THROW(static_cast<void>(vector.at(front)), std::out_of_range);
+        BOOST_CHECK_EQUAL(1, *vector.get(first));
+    }
+
+    BOOST_AUTO_TEST_CASE(ReusedSequence_DetectedByGeneration)
+    {
+        DVector::HandleDVector<int> vector;
+        vector.push_back(1);
+        const DVector::Handle old = vector.push_back(2);
+        vector.pop_back();
+        const DVector::Handle reused = vector.push_back(3);
+
+        BOOST_CHECK_EQUAL(old.sequence, reused.sequence);
+        BOOST_CHECK(old != reused);
+        BOOST_CHECK(!vector.contains(old));
+        BOOST_CHECK_EQUAL(3, vector.at(reused));
+    }
+
+    BOOST_AUTO_TEST_CASE(NullHandle_And_Clear)
+    {
+        DVector::HandleDVector<int> vector;
+        BOOST_CHECK(!vector.contains(DVector::Handle {}));
+
+        const DVector::Handle handle = vector.push_back(5);
+        BOOST_CHECK(vector.HandleAt(0) == handle);
+        vector.Clear();
+        BOOST_CHECK(!vector.contains(handle));
+
+        const DVector::Handle next = vector.push_back(6);
+        BOOST_CHECK_NE(handle.sequence, next.sequence);
+        BOOST_CHECK_EQUAL(6, vector.at(next));
+    }
+
+    BOOST_AUTO_TEST_CASE(QueueUsage_SequenceWrapAround)
+    {
+        DVector::HandleDVector<uint64_t> vector;
+        DVector::Handle last;
+        for (uint64_t idx = 0; idx < 100'000; ++idx) {
+            last = vector.push_front(idx);
+            if (vector.Size() > 10)
+                vector.pop_back();
+        }
+        BOOST_CHECK_EQUAL(10UL, vector.Size());
+        BOOST_CHECK_EQUAL(99'999UL, vector.at(last));
+        BOOST_CHECK_EQUAL(99'990UL, vector.at(vector.HandleAt(9)));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_AUTO_TEST_SUITE(DVectorTraceTests)
+
+    BOOST_AUTO_TEST_CASE(TracedOperations_ReadBack)
+    {
+        using DVector::Trace::Operation;
+        std::stringstream stream;
+        {
+            DVector::Trace::Recorder recorder { stream, sizeof(int) };
+            DVector::Trace::TracedDVector<int> vector { recorder, 300 };
+            vector.push_back(1);
+            vector.push_front(0);
+            vector[1] = 5;
+            BOOST_CHECK_EQUAL(5, vector.Storage()[1]);
+            vector.pop_back();
+            vector.pop_front();
+            vector.Clear();
+        }
+
+        DVector::Trace::Reader reader { stream };
+        BOOST_CHECK_EQUAL(sizeof(int), reader.ElementSize());
+
+        const std::vector<std::pair<Operation, uint64_t>> expected {
+            { Operation::Create, 300 }, { Operation::PushBack, 0 }, { Operation::PushFront, 0 },
+            { Operation::Index, 1 }, { Operation::PopBack, 0 }, { Operation::PopFront, 0 },
+            { Operation::Clear, 0 }, { Operation::Destroy, 0 }
+        };
+        for (const auto& [operation, argument]: expected) {
+            const std::optional<DVector::Trace::Record> record = reader.next();
+            BOOST_REQUIRE(record.has_value());
+            BOOST_CHECK(operation == record->operation);
+            BOOST_CHECK_EQUAL(1U, record->instance);
+            BOOST_CHECK_EQUAL(argument, record->argument);
+        }
+        BOOST_CHECK(!reader.next().has_value());
+    }
+
+    BOOST_AUTO_TEST_CASE(Instances_And_LargeArguments)
+    {
+        std::stringstream stream;
+        DVector::Trace::Recorder recorder { stream, 64 };
+        {
+            DVector::Trace::TracedDVector<uint64_t> first { recorder };
+            DVector::Trace::TracedDVector<uint64_t> second { recorder, 1'000'000 };
+            second.push_back(7);
+        }
+
+        DVector::Trace::Reader reader { stream };
+        BOOST_CHECK_EQUAL(64U, reader.ElementSize());
+        std::vector<DVector::Trace::Record> records;
+        while (const std::optional<DVector::Trace::Record> record = reader.next())
+            records.push_back(*record);
+
+        BOOST_REQUIRE_EQUAL(5U, records.size());
+        BOOST_CHECK_EQUAL(0U, records[0].argument);
+        BOOST_CHECK_EQUAL(2U, records[1].instance);
+        BOOST_CHECK_EQUAL(1'000'000U, records[1].argument);
+        BOOST_CHECK_EQUAL(2U, records[3].instance);
+        BOOST_CHECK_EQUAL(1U, records[4].instance);
+    }
+
+    BOOST_AUTO_TEST_CASE(Malformed_Trace_Throws)
+    {
+        std::stringstream notTrace { "not a trace" };
+        BOOST_CHECK_THROW(DVector::Trace::Reader { notTrace }, std::runtime_error);
+
+        std::stringstream truncated;
+        {
+            DVector::Trace::Recorder recorder { truncated, 4 };
+            recorder.Create(1000);
+        }
+        std::string bytes = truncated.str();
+        bytes.pop_back();
+        std::stringstream input { bytes };
+        DVector::Trace::Reader reader { input };
+        BOOST_CHECK_THROW(static_cast<void>(reader.next()), std::runtime_error);
+
+        std::stringstream unknown;
+        DVector::Trace::Recorder { unknown, 4 };
+        unknown.put(static_cast<char>(42));
+        DVector::Trace::Reader unknownReader { unknown };
+        BOOST_CHECK_THROW(static_cast<void>(unknownReader.next()), std::runtime_error);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_AUTO_TEST_SUITE(StringDVectorTests)
+
+    BOOST_AUTO_TEST_CASE(PushBoth_Sides_Views)
+    {
+        DVector::StringDVector strings;
+        strings.push_back("beta");
+        strings.push_front("alpha");
+        strings.push_back("");
+        strings.push_back("gamma");
+        strings.push_front("zero");
+
+        BOOST_REQUIRE_EQUAL(5U, strings.Size());
+        BOOST_CHECK_EQUAL("zero", strings[0]);
+        BOOST_CHECK_EQUAL("alpha", strings[1]);
+        BOOST_CHECK_EQUAL("beta", strings[2]);
+        BOOST_CHECK(strings[3].empty());
+        BOOST_CHECK_EQUAL("gamma", strings.Back());
+        BOOST_CHECK_EQUAL(18U, strings.Bytes());
+        BOOST_CHECK_THROW(static_cast<void>(strings.at(5)), std::out_of_range);
+
+        /** All the strings are adjacent in the arena: **/
+        BOOST_CHECK(strings[0].data() + strings[0].size() == strings[1].data());
+        BOOST_CHECK(strings[2].data() + strings[2].size() == strings[4].data());
+    }
+
+    BOOST_AUTO_TEST_CASE(Pop_And_Clear)
+    {
+        DVector::StringDVector strings;
+        for (const char* s: { "one", "two", "three" })
+            strings.push_back(s);
+        strings.pop_front();
+        strings.pop_back();
+        BOOST_REQUIRE_EQUAL(1U, strings.Size());
+        BOOST_CHECK_EQUAL("two", strings.Front());
+        BOOST_CHECK_EQUAL(3U, strings.Bytes());
+
+        strings.Clear();
+        BOOST_CHECK(strings.Empty());
+        BOOST_CHECK_EQUAL(0U, strings.Bytes());
+        strings.push_front("again");
+        BOOST_CHECK_EQUAL("again", strings[0]);
+    }
+
+    BOOST_AUTO_TEST_CASE(Many_Strings_MatchReference)
+    {
+        DVector::StringDVector strings;
+        std::deque<std::string> expected;
+        for (int idx = 0; idx < 20'000; ++idx)
+        {
+            std::string value = std::string(idx % 37, 'a' + idx % 26) + std::to_string(idx);
+            if (0 == idx % 3) {
+                strings.push_front(value);
+                expected.push_front(std::move(value));
+            } else {
+                strings.push_back(value);
+                expected.push_back(std::move(value));
+            }
+        }
+
+        BOOST_REQUIRE_EQUAL(expected.size(), strings.Size());
+        for (size_t idx = 0; idx < expected.size(); ++idx)
+            BOOST_REQUIRE_EQUAL(expected[idx], strings[idx]);
+    }
+
+    BOOST_AUTO_TEST_CASE(RemoveIf_Compacts)
+    {
+        DVector::StringDVector strings;
+        strings.push_back("keep-1");
+        strings.push_back("drop");
+        strings.push_front("drop");
+        strings.push_front("keep-0");
+        strings.push_back("keep-2");
+        strings.push_back("drop");
+
+        BOOST_CHECK_EQUAL(3U, strings.remove_if([](std::string_view s) { return s == "drop"; }));
+        BOOST_REQUIRE_EQUAL(3U, strings.Size());
+        BOOST_CHECK_EQUAL(18U, strings.Bytes());
+
+        std::vector<std::string> values;
+        strings.forEach([&values](std::string_view s) { values.emplace_back(s); });
+        BOOST_CHECK(values == std::vector<std::string>({ "keep-0", "keep-1", "keep-2" }));
+
+        strings.ShrinkToFit();
+        strings.push_front("new");
+        BOOST_CHECK_EQUAL("new", strings[0]);
+        BOOST_CHECK_EQUAL("keep-2", strings[3]);
+        BOOST_CHECK_EQUAL(0U, strings.remove_if([](std::string_view) { return false; }));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_AUTO_TEST_SUITE(GapDVectorTests)
+
+    std::string toString(const DVector::GapDVector<char>& text)
+    {
+        std::string result;
+        text.forEach([&result](char c) { result.push_back(c); });
+        return result;
+    }
+
+    BOOST_AUTO_TEST_CASE(Typing_AtTheCursor)
+    {
+        DVector::GapDVector<char> text;
+        text.insert_range(std::string_view { "hello world" });
+        text.move_to(5);
+        text.insert(',');
+        BOOST_CHECK_EQUAL(6U, text.Cursor());
+        BOOST_CHECK_EQUAL("hello, world", toString(text));
+
+        text.move_to(0);
+        text.insert('>');
+        text.insert(' ');
+        BOOST_CHECK_EQUAL("> hello, world", toString(text));
+        BOOST_CHECK_EQUAL('h', text[2]);
+        BOOST_CHECK_EQUAL('d', text.at(13));
+        BOOST_CHECK_THROW(static_cast<void>(text.at(14)), std::out_of_range);
+    }
+
+    BOOST_AUTO_TEST_CASE(Backspace_And_Delete)
+    {
+        DVector::GapDVector<char> text;
+        text.insert_range(std::string_view { "abcdef" });
+        text.move_left(3);
+        text.erase_before();
+        text.erase_after(2);
+        BOOST_CHECK_EQUAL("abf", toString(text));
+        BOOST_CHECK_EQUAL(2U, text.Cursor());
+
+        BOOST_CHECK_THROW(text.move_left(3), std::out_of_range);
+        BOOST_CHECK_THROW(text.move_right(2), std::out_of_range);
+        text.Clear();
+        BOOST_CHECK(text.Empty());
+        BOOST_CHECK_EQUAL(0U, text.Cursor());
+    }
+
+    BOOST_AUTO_TEST_CASE(Spans_AroundTheGap)
+    {
+        DVector::GapDVector<int> values;
+        for (int idx = 0; idx < 10; ++idx)
+            values.insert(idx);
+        values.move_to(4);
+
+        const std::span<int> before = values.Before(), after = values.After();
+        BOOST_REQUIRE_EQUAL(4U, before.size());
+        BOOST_REQUIRE_EQUAL(6U, after.size());
+        BOOST_CHECK_EQUAL(3, before.back());
+        BOOST_CHECK_EQUAL(4, after.front());
+        BOOST_CHECK_EQUAL(9, after.back());
+    }
+
+    BOOST_AUTO_TEST_CASE(RandomEdits_MatchReference)
+    {
+        std::mt19937 generator { 42 };
+        DVector::GapDVector<std::string> values;
+        std::vector<std::string> expected;
+        size_t cursor = 0;
+
+        for (int step = 0; step < 5'000; ++step)
+        {
+            switch (generator() % 4)
+            {
+                case 0: case 1:
+                    values.insert(std::to_string(step));
+                    expected.insert(expected.begin() + cursor++, std::to_string(step));
+                    break;
+                case 2:
+                    if (0 != cursor) {
+                        values.erase_before();
+                        expected.erase(expected.begin() + --cursor);
+                    }
+                    break;
+                default:
+                    cursor = generator() % (expected.size() + 1);
+                    values.move_to(cursor);
+                    break;
+            }
+            BOOST_REQUIRE_EQUAL(cursor, values.Cursor());
+        }
+
+        BOOST_REQUIRE_EQUAL(expected.size(), values.Size());
+        for (size_t idx = 0; idx < expected.size(); ++idx)
+            BOOST_REQUIRE_EQUAL(expected[idx], values[idx]);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_AUTO_TEST_SUITE(TombstoneDVectorTests)
+
+    template<typename Vector>
+    auto toVector(const Vector& vector)
+    {
+        std::vector<std::remove_cvref_t<decltype(*vector.begin())>> values;
+        vector.forEach([&values](const auto& value) { values.push_back(value); });
+        return values;
+    }
+
+    BOOST_AUTO_TEST_CASE(LazyErase_SkippedBy_Size_And_Iteration)
+    {
+        DVector::TombstoneDVector<int> vector { 0, 0.5 };
+        for (int idx = 0; idx < 10; ++idx)
+            vector.push_back(idx);
+
+        BOOST_CHECK(!vector.lazy_erase(3));
+        BOOST_CHECK(!vector.lazy_erase(0));
+        BOOST_CHECK(!vector.lazy_erase(0));
+        BOOST_CHECK_EQUAL(8U, vector.Size());
+        BOOST_CHECK_EQUAL(10U, vector.Slots());
+        BOOST_CHECK(vector.IsErased(3));
+        BOOST_CHECK_EQUAL(4, vector[4]);
+
+        BOOST_CHECK(toVector(vector) == std::vector<int>({ 1, 2, 4, 5, 6, 7, 8, 9 }));
+        BOOST_CHECK_EQUAL(1U, vector.begin().Slot());
+        BOOST_CHECK_THROW(vector.lazy_erase(10), std::out_of_range);
+    }
+
+    BOOST_AUTO_TEST_CASE(TrailingTombstones_Dropped)
+    {
+        DVector::TombstoneDVector<int> vector;
+        for (int idx = 0; idx < 8; ++idx)
+            vector.push_back(idx);
+        BOOST_CHECK(!vector.lazy_erase(6));
+        BOOST_CHECK(!vector.lazy_erase(7));
+        BOOST_CHECK_EQUAL(6U, vector.Slots());
+        BOOST_CHECK_EQUAL(0U, vector.DeadCount());
+    }
+
+    BOOST_AUTO_TEST_CASE(Threshold_Triggers_Compaction)
+    {
+        DVector::TombstoneDVector<int> vector { 0, 0.25 };
+        for (int idx = 0; idx < 100; ++idx)
+            vector.push_back(idx);
+
+        size_t erasedCount = 0;
+        bool compacted = false;
+        for (size_t slot = 0; !compacted; slot += 2, ++erasedCount)
+            compacted = vector.lazy_erase(slot);
+
+        BOOST_CHECK_EQUAL(26U, erasedCount);
+        BOOST_CHECK_EQUAL(74U, vector.Size());
+        BOOST_CHECK_EQUAL(vector.Size(), vector.Slots());
+        BOOST_CHECK_EQUAL(0U, vector.DeadCount());
+        BOOST_CHECK_EQUAL(1, vector[0]);
+        BOOST_CHECK_EQUAL(3, vector[1]);
+        BOOST_CHECK_EQUAL(49, vector[24]);
+        BOOST_CHECK_EQUAL(51, vector[25]);
+        BOOST_CHECK_EQUAL(52, vector[26]);
+    }
+
+    BOOST_AUTO_TEST_CASE(Compaction_NonTrivial_MatchesReference)
+    {
+        std::mt19937 generator { 7 };
+        DVector::TombstoneDVector<std::string> vector { 0, 0.3 };
+        std::vector<std::string> expected;
+        for (int idx = 0; idx < 1'000; ++idx) {
+            vector.push_back(std::to_string(idx));
+            expected.push_back(std::to_string(idx));
+        }
+        vector.push_front("front");
+        expected.insert(expected.begin(), "front");
+
+        for (int step = 0; step < 600 && !expected.empty(); ++step)
+        {
+            const size_t live = generator() % vector.Size();
+            auto iter = vector.begin();
+            std::advance(iter, live);
+            vector.lazy_erase(iter.Slot());
+            expected.erase(expected.begin() + static_cast<std::ptrdiff_t>(live));
+            BOOST_REQUIRE_EQUAL(expected.size(), vector.Size());
+        }
+
+        BOOST_CHECK(toVector(vector) == expected);
+        vector.Compact();
+        BOOST_CHECK_EQUAL(expected.size(), vector.Slots());
+        for (size_t idx = 0; idx < expected.size(); ++idx)
+            BOOST_REQUIRE_EQUAL(expected[idx], vector[idx]);
+    }
+
+    BOOST_AUTO_TEST_CASE(Compaction_Spans_Words)
+    {
+        DVector::TombstoneDVector<uint64_t> vector { 0, 1.0 };
+        for (uint64_t idx = 0; idx < 1'000; ++idx)
+            vector.push_back(idx);
+        for (size_t slot = 60; slot < 200; ++slot)
+            vector.lazy_erase(slot);
+        vector.lazy_erase(500);
+
+        vector.Compact();
+        BOOST_REQUIRE_EQUAL(859U, vector.Slots());
+        BOOST_CHECK_EQUAL(59UL, vector[59]);
+        BOOST_CHECK_EQUAL(200UL, vector[60]);
+        BOOST_CHECK_EQUAL(499UL, vector[359]);
+        BOOST_CHECK_EQUAL(501UL, vector[360]);
+        BOOST_CHECK_EQUAL(999UL, vector[858]);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_AUTO_TEST_SUITE(ShmDVectorTests)
+
+    struct Order
+    {
+        uint64_t id { 0 };
+        double price { 0 };
+        uint32_t quantity { 0 };
+    };
+
+    BOOST_AUTO_TEST_CASE(PushPop_SameProcess_Grows)
+    {
+        auto vector = DVector::ShmDVector<Order>::Create(4);
+        BOOST_CHECK(vector.Empty());
+
+        Order order;
+        BOOST_CHECK(!vector.pop_front(order));
+
+        for (uint64_t id = 0; id < 1'000; ++id)
+            vector.push_back(Order { id, 1.5 * static_cast<double>(id), static_cast<uint32_t>(id % 7) });
+        BOOST_CHECK_EQUAL(1'000U, vector.Size());
+        BOOST_CHECK_GE(vector.Capacity(), 1'000U);
+
+        for (uint64_t id = 0; id < 1'000; ++id) {
+            BOOST_REQUIRE(vector.pop_front(order));
+            BOOST_REQUIRE_EQUAL(id, order.id);
+            BOOST_REQUIRE_EQUAL(static_cast<uint32_t>(id % 7), order.quantity);
+        }
+        BOOST_CHECK(vector.Empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(RetiredRings_Released_AfterLastGrowth)
+    {
+        auto vector = DVector::ShmDVector<Order>::Create(4);
+        for (uint64_t id = 0; id < 1'000; ++id)
+            vector.push_back(Order { id, 0.0, 0 });
+
+        Order order;
+        while (vector.pop_front(order)) {
+        }
+
+        /** Only the header page and the live ring stay committed: **/
+        const size_t pageSize = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        const size_t ringBytes = (vector.Capacity() * sizeof(Order) + pageSize - 1) / pageSize * pageSize;
+        struct stat status {};
+        BOOST_REQUIRE_EQUAL(0, ::fstat(vector.Descriptor(), &status));
+        BOOST_CHECK_LT(ringBytes, static_cast<size_t>(status.st_size) - pageSize);
+        BOOST_CHECK_GE(pageSize + ringBytes, static_cast<size_t>(status.st_blocks) * 512);
+    }
+
+    BOOST_AUTO_TEST_CASE(Named_Segment_Two_Mappings)
+    {
+        const std::string name = std::format("/dvector-test-{}", ::getpid());
+        DVector::ShmDVector<uint64_t>::Unlink(name);
+        auto producer = DVector::ShmDVector<uint64_t>::Create(name, 8);
+        auto consumer = DVector::ShmDVector<uint64_t>::Open(name);
+        DVector::ShmDVector<uint64_t>::Unlink(name);
+        BOOST_CHECK_THROW(DVector::ShmDVector<Order>::Attach(producer.Descriptor()), std::invalid_argument);
+
+        std::vector<uint64_t> values(100), received(64);
+        uint64_t next = 0, expected = 0;
+        for (int round = 0; round < 50; ++round)
+        {
+            std::iota(values.begin(), values.end(), next);
+            producer.push_back(std::span<const uint64_t> { values.data(), 10 + static_cast<size_t>(round) });
+            next += 10 + round;
+
+            const size_t count = consumer.pop_front(received);
+            for (size_t idx = 0; idx < count; ++idx)
+                BOOST_REQUIRE_EQUAL(expected++, received[idx]);
+        }
+        while (const size_t count = consumer.pop_front(received))
+            for (size_t idx = 0; idx < count; ++idx)
+                BOOST_REQUIRE_EQUAL(expected++, received[idx]);
+        BOOST_CHECK_EQUAL(next, expected);
+        BOOST_CHECK_GT(consumer.Capacity(), 8U);
+    }
+
+    BOOST_AUTO_TEST_CASE(Named_Create_Failure_RemovesName)
+    {
+        const std::string name = std::format("/dvector-failed-{}", ::getpid());
+        DVector::ShmDVector<uint64_t>::Unlink(name);
+
+        /** The ring is larger than the address space, mapping it fails: **/
+        BOOST_CHECK_THROW(DVector::ShmDVector<uint64_t>::Create(name, size_t { 1 } << 46), std::system_error);
+        BOOST_CHECK_THROW(DVector::ShmDVector<uint64_t>::Open(name), std::system_error);
+
+        auto vector = DVector::ShmDVector<uint64_t>::Create(name, 8);
+        DVector::ShmDVector<uint64_t>::Unlink(name);
+        vector.push_back(42);
+        BOOST_CHECK_EQUAL(1U, vector.Size());
+    }
+
+    BOOST_AUTO_TEST_CASE(Fork_Producer_Consumer)
+    {
+        constexpr uint64_t count { 500'000 };
+        auto vector = DVector::ShmDVector<Order>::Create(16);
+
+        const pid_t child = ::fork();
+        BOOST_REQUIRE_NE(-1, child);
+        if (0 == child)
+        {
+            /** Consumer, must not return into the test framework: **/
+            std::array<Order, 256> orders {};
+            uint64_t expected = 0;
+            while (expected < count)
+            {
+                const size_t popped = vector.pop_front(orders);
+                if (0 == popped)
+                    std::this_thread::yield();
+                for (size_t idx = 0; idx < popped; ++idx, ++expected)
+                    if (orders[idx].id != expected || orders[idx].quantity != static_cast<uint32_t>(expected % 100))
+                        ::_exit(1);
+            }
+            ::_exit(0);
+        }
+
+        std::array<Order, 32> batch {};
+        for (uint64_t id = 0; id < count;)
+        {
+            if (0 == id % 3) {
+                vector.push_back(Order { id, 0.0, static_cast<uint32_t>(id % 100) });
+                ++id;
+                continue;
+            }
+            const size_t size = std::min<uint64_t>(batch.size(), count - id);
+            for (size_t idx = 0; idx < size; ++idx, ++id)
+                batch[idx] = Order { id, 0.0, static_cast<uint32_t>(id % 100) };
+            vector.push_back(std::span<const Order> { batch.data(), size });
+        }
+
+        int status = 0;
+        BOOST_REQUIRE_EQUAL(child, ::waitpid(child, &status, 0));
+        BOOST_CHECK(WIFEXITED(status));
+        BOOST_CHECK_EQUAL(0, WEXITSTATUS(status));
+        BOOST_CHECK(vector.Empty());
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_AUTO_TEST_SUITE(DVectorSortTests)
+
+    template<typename Type, typename Generate>
+    void checkSorted(const size_t count, Generate generate)
+    {
+        std::mt19937_64 generator { count };
+        DVector::DVector<Type> vector;
+        std::vector<Type> expected;
+        for (size_t idx = 0; idx < count; ++idx) {
+            const Type value = generate(generator);
+            0 == idx % 2 ? vector.push_back(value) : vector.push_front(value);
+            expected.push_back(value);
+        }
+
+        DVector::sort(vector);
+        std::sort(expected.begin(), expected.end());
+        BOOST_REQUIRE_EQUAL(expected.size(), vector.Size());
+        for (size_t idx = 0; idx < count; ++idx)
+            BOOST_REQUIRE_EQUAL(expected[idx], vector[idx]);
+    }
+
+    BOOST_AUTO_TEST_CASE(Radix_Integers)
+    {
+        for (const size_t count: { 0UL, 1UL, 100UL, 1'000UL, 100'000UL }) {
+            checkSorted<uint32_t>(count, [](auto& gen) { return static_cast<uint32_t>(gen()); });
+            checkSorted<int64_t>(count, [](auto& gen) { return static_cast<int64_t>(gen()); });
+            checkSorted<int16_t>(count, [](auto& gen) { return static_cast<int16_t>(gen()); });
+            checkSorted<uint8_t>(count, [](auto& gen) { return static_cast<uint8_t>(gen()); });
+        }
+        /** Only the low digit differs, the other passes are skipped: **/
+        checkSorted<uint64_t>(10'000, [](auto& gen) { return gen() % 200; });
+    }
+
+    BOOST_AUTO_TEST_CASE(Radix_Floats)
+    {
+        checkSorted<double>(50'000, [](auto& gen) {
+            return std::uniform_real_distribution<double> { -1e9, 1e9 }(gen);
+        });
+        checkSorted<float>(50'000, [](auto& gen) {
+            return std::uniform_real_distribution<float> { -1.0f, 1.0f }(gen) * static_cast<float>(gen() % 1000);
+        });
+    }
+
+    BOOST_AUTO_TEST_CASE(SortByKey_Records_Stable)
+    {
+        struct Record
+        {
+            int32_t key;
+            uint32_t order;
+        };
+
+        DVector::DVector<Record> vector;
+        for (uint32_t idx = 0; idx < 20'000; ++idx)
+            vector.push_back(Record { static_cast<int32_t>(idx * 7919 % 1000) - 500, idx });
+
+        DVector::sort_by_key(vector, [](const Record& record) { return record.key; });
+        for (size_t idx = 1; idx < vector.Size(); ++idx) {
+            BOOST_REQUIRE_LE(vector[idx - 1].key, vector[idx].key);
+            if (vector[idx - 1].key == vector[idx].key)
+                BOOST_REQUIRE_LT(vector[idx - 1].order, vector[idx].order);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(SortByKey_InitializedRecords_Radix)
+    {
+        struct Record
+        {
+            int32_t key { 0 };
+            uint32_t order { 0 };
+        };
+        static_assert(!std::is_trivial_v<Record> && std::is_trivially_copyable_v<Record>);
+
+        using Vector = DVector::DVector<Record, Instrumentation::CountingAllocator<Record>>;
+        for (const bool tight: { false, true })
+        {
+            Vector vector (tight ? 0 : 50'000);
+            for (uint32_t idx = 0; idx < 10'000; ++idx)
+                vector.push_back(Record { static_cast<int32_t>(idx * 7919 % 1000) - 500, idx });
+            if (tight)
+                vector.ShrinkToFit();
+
+            /** The radix path takes the scratch from the headroom or allocates it, std::stable_sort does neither: **/
+            Instrumentation::reset();
+            DVector::sort_by_key(vector, [](const Record& record) { return record.key; });
+            BOOST_CHECK_EQUAL(tight ? 1UL : 0UL, Instrumentation::AllocationStats::allocations);
+
+            for (size_t idx = 1; idx < vector.Size(); ++idx) {
+                BOOST_REQUIRE_LE(vector[idx - 1].key, vector[idx].key);
+                if (vector[idx - 1].key == vector[idx].key)
+                    BOOST_REQUIRE_LT(vector[idx - 1].order, vector[idx].order);
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(SortByKey_NonTrivial_Stable)
+    {
+        DVector::DVector<std::pair<double, std::string>> vector;
+        for (int idx = 0; idx < 1'000; ++idx)
+            vector.push_back({ static_cast<double>(idx % 10) - 4.5, std::to_string(idx) });
+
+        DVector::sort_by_key(vector, [](const auto& entry) { return entry.first; });
+        BOOST_CHECK_EQUAL(-4.5, vector.Front().first);
+        BOOST_CHECK_EQUAL("0", vector.Front().second);
+        BOOST_CHECK_EQUAL("10", vector[1].second);
+        BOOST_CHECK_EQUAL("999", vector.Back().second);
+    }
+
+    BOOST_AUTO_TEST_CASE(Radix_UsesHeadroom_AsScratch)
+    {
+        using Vector = DVector::DVector<uint32_t, Instrumentation::CountingAllocator<uint32_t>>;
+        std::mt19937 generator { 3 };
+
+        Vector withRoom (100'000);
+        for (int idx = 0; idx < 1'000; ++idx)
+            withRoom.push_back(generator());
+        Instrumentation::reset();
+        DVector::sort(withRoom);
+        BOOST_CHECK_EQUAL(0UL, Instrumentation::AllocationStats::allocations);
+        BOOST_CHECK(std::is_sorted(withRoom.begin(), withRoom.end()));
+
+        Vector tight;
+        for (int idx = 0; idx < 1'000; ++idx)
+            tight.push_back(generator());
+        tight.ShrinkToFit();
+        Instrumentation::reset();
+        DVector::sort(tight);
+        BOOST_CHECK_EQUAL(1UL, Instrumentation::AllocationStats::allocations);
+        BOOST_CHECK_EQUAL(1UL, Instrumentation::AllocationStats::deallocations);
+        BOOST_CHECK(std::is_sorted(tight.begin(), tight.end()));
+    }
+
+    BOOST_AUTO_TEST_CASE(Parallel_ComparisonSort)
+    {
+        std::mt19937 generator { 11 };
+        DVector::DVector<uint32_t> numbers;
+        for (int idx = 0; idx < 500'000; ++idx)
+            numbers.push_back(generator());
+        DVector::sort(numbers, std::greater<> {});
+        BOOST_CHECK(std::is_sorted(numbers.begin(), numbers.end(), std::greater<> {}));
+
+        /** Uneven chunks and an odd number of them: **/
+        for (const size_t threads: { 3UL, 4UL }) {
+            std::shuffle(numbers.begin(), numbers.end(), generator);
+            DVector::Sorting::parallelSort(numbers.begin(), numbers.end(), std::less<> {}, threads);
+            BOOST_CHECK(std::is_sorted(numbers.begin(), numbers.end()));
+        }
+
+        DVector::DVector<std::string> strings;
+        std::vector<std::string> expected;
+        for (int idx = 0; idx < 200'000; ++idx) {
+            strings.push_front(std::to_string(generator()));
+            expected.push_back(strings.Front());
+        }
+        DVector::sort(strings);
+        std::sort(expected.begin(), expected.end());
+        BOOST_REQUIRE_EQUAL(expected.size(), strings.Size());
+        BOOST_CHECK(std::equal(expected.begin(), expected.end(), strings.begin()));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()